@@ -50,6 +50,9 @@ OF THIRD PARTY RIGHTS.
 #include <dynarithmic/twain/options/micr_options.hpp>
 #include <dynarithmic/twain/options/imprinter_options.hpp>
 #include <dynarithmic/twain/options/blankpage_options.hpp>
+#include <dynarithmic/twain/options/colordetection_options.hpp>
+#include <dynarithmic/twain/options/deskew_options.hpp>
+#include <dynarithmic/twain/options/duplicatepage_options.hpp>
 #include <dynarithmic/twain/options/autoscanning_options.hpp>
 
 namespace dynarithmic {
@@ -85,6 +88,9 @@ namespace twain {
              language_options m_language_options;
              userinterface_options m_userinterface_options;
              blankpage_options m_blankpage_options;
+             colordetection_options m_colordetection_options;
+             duplicatepage_options m_duplicatepage_options;
+             deskew_options m_deskew_options;
              powermonitor_options m_powermonitor_options;
 
              friend class twain_source;
@@ -184,6 +190,9 @@ namespace twain {
              resolution_options&         get_resolution_options() noexcept { return m_resolution_options; }
              userinterface_options&      get_userinterface_options() noexcept { return m_userinterface_options; }
              blankpage_options&          get_blank_page_options() noexcept { return m_blankpage_options; }
+             colordetection_options&     get_color_detection_options() noexcept { return m_colordetection_options; }
+             duplicatepage_options&      get_duplicate_page_options() noexcept { return m_duplicatepage_options; }
+             deskew_options&             get_deskew_options() noexcept { return m_deskew_options; }
              pdf_options&                get_pdf_options() noexcept { return m_pdf_options; }
      };
   }
@@ -0,0 +1,342 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_CAPABILITY_CONSTRAINTS_HPP
+#define DTWAIN_CAPABILITY_CONSTRAINTS_HPP
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <ostream>
+#include <algorithm>
+#include <dynarithmic/twain/capability_interface/capability_interface.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        enum class validation_status
+        {
+            valid,                      // the device accepts the value
+            capability_not_supported,   // the device does not support the capability
+            value_not_supported,        // the device supports the capability, but not the value
+            not_checked                 // the value could not be checked against the device's constraints
+        };
+
+        struct validation_result
+        {
+            int cap_value = 0;
+            validation_status status = validation_status::not_checked;
+            capability_values requested;
+        };
+
+        /// The consolidated result of validating a set of capability settings against a capability_constraint_set.
+        class validation_report
+        {
+            std::vector<validation_result> m_results;
+
+            public:
+                validation_report() = default;
+                explicit validation_report(std::vector<validation_result>&& results) : m_results(std::move(results)) {}
+
+                const std::vector<validation_result>& get_results() const noexcept { return m_results; }
+
+                /// Returns the result for the capability, or nullptr if no setting of the capability was validated
+                const validation_result* find(int cap_value) const
+                {
+                    auto iter = std::find_if(m_results.begin(), m_results.end(),
+                                             [&](const validation_result& r) { return r.cap_value == cap_value; });
+                    return iter != m_results.end() ? &(*iter) : nullptr;
+                }
+
+                size_t count(validation_status status) const
+                {
+                    return std::count_if(m_results.begin(), m_results.end(),
+                                         [&](const validation_result& r) { return r.status == status; });
+                }
+
+                /// Returns **true** if no setting was rejected
+                bool is_valid() const
+                {
+                    return count(validation_status::capability_not_supported) == 0 &&
+                           count(validation_status::value_not_supported) == 0;
+                }
+        };
+
+        inline const char* to_string(validation_status status)
+        {
+            switch (status)
+            {
+                case validation_status::valid:
+                    return "ok";
+                case validation_status::capability_not_supported:
+                    return "capability not supported";
+                case validation_status::value_not_supported:
+                    return "value not supported";
+                default:
+                    return "not checked";
+            }
+        }
+
+        inline std::ostream& operator <<(std::ostream& os, const validation_report& report)
+        {
+            for (auto& r : report.get_results())
+                os << capability_interface::get_cap_name_s(r.cap_value) << ": " << to_string(r.status) << "\n";
+            os << report.count(validation_status::valid) << " valid, "
+               << report.count(validation_status::capability_not_supported) << " unsupported capabilities, "
+               << report.count(validation_status::value_not_supported) << " unsupported values, "
+               << report.count(validation_status::not_checked) << " not checked\n";
+            return os;
+        }
+
+        /// The supported values and ranges of a device's capabilities.
+        ///
+        /// The constraint set is built from the device once, using a single capability_snapshot, and can be saved and
+        /// loaded again.  Validating settings against a constraint set does not contact the device.
+        ///
+        /// The key is set by the application, and is saved with the constraints, so that a saved constraint set can be
+        /// matched to the device (and driver version) it was built from.
+        class capability_constraint_set
+        {
+            public:
+                struct constraint
+                {
+                    twain_container_type::value_type container_type = twain_container_type::CONTAINER_INVALID;
+                    bool values_known = false;
+                    capability_values allowed;
+                };
+
+            private:
+                static constexpr const char* constraint_header = "twain-capability-constraints";
+                static constexpr int constraint_version = 2;
+
+                std::string m_productName;
+                std::string m_key;
+                std::map<int, constraint> m_constraints;
+
+                static bool is_value_close(double value1, double value2)
+                {
+                    return std::fabs(value1 - value2) <= 1.0e-6;
+                }
+
+                // the range values are the minimum, maximum and step, followed by the default and current values
+                static bool is_value_in_range(double value, const std::vector<double>& range)
+                {
+                    if (value < range[0] - 1.0e-6 || value > range[1] + 1.0e-6)
+                        return false;
+                    const double step = range.size() > 2 ? range[2] : 0.0;
+                    if (step <= 0.0)
+                        return true;
+                    const double num_steps = std::floor((value - range[0]) / step + 0.5);
+                    return is_value_close(value, range[0] + num_steps * step);
+                }
+
+                static bool write_string(std::ostream& strm, const std::string& str)
+                {
+                    strm << str.size() << ":" << str << "\n";
+                    return strm.good();
+                }
+
+                static bool read_string(std::istream& strm, std::string& str)
+                {
+                    size_t len = 0;
+                    char sep = 0;
+                    if (!(strm >> len) || !strm.get(sep) || sep != ':')
+                        return false;
+                    str.resize(len);
+                    return len == 0 || strm.read(&str[0], static_cast<std::streamsize>(len));
+                }
+
+            public:
+                /// Builds the constraints of all the capabilities that the device attached to **ci** supports
+                static capability_constraint_set build(const capability_interface& ci, std::string product_name)
+                {
+                    return build(ci, std::move(product_name), ci.get_caps<std::vector<int>>());
+                }
+
+                /// Builds the constraints of the capabilities in **caps** from the device attached to **ci**.  Capabilities
+                /// that the device does not support are left out of the constraint set.
+                static capability_constraint_set build(const capability_interface& ci, std::string product_name,
+                                                       const std::vector<int>& caps)
+                {
+                    capability_constraint_set cs;
+                    cs.m_productName = std::move(product_name);
+                    if (caps.empty())
+                        return cs;
+
+                    std::vector<capability_query> queries;
+                    for (auto cap : caps)
+                    {
+                        if (ci.is_cap_supported(cap))
+                            queries.push_back({ cap, get_operation_type::GET });
+                    }
+                    const auto snapshot = ci.get_snapshot(std::move(queries));
+                    for (auto& e : snapshot.get_entries())
+                    {
+                        constraint c;
+                        // the snapshot infers the container type from the number of values if it is not known yet, which
+                        // reports an enumeration of a single value as a one-value container.  Apart from ranges, the
+                        // container type is taken from the device, which only asks it once for each capability.
+                        c.container_type = e.second.is_range ? twain_container_type::CONTAINER_RANGE :
+                                                               ci.get_cap_container_type(e.first.cap_value, capability_interface::get());
+                        if (c.container_type == twain_container_type::CONTAINER_INVALID)
+                            c.container_type = e.second.container_type;
+                        c.values_known = e.second.return_value;
+                        c.allowed = e.second;
+                        cs.m_constraints.insert({ e.first.cap_value, std::move(c) });
+                    }
+                    return cs;
+                }
+
+                const std::string& get_product_name() const noexcept { return m_productName; }
+                const std::string& get_key() const noexcept { return m_key; }
+                capability_constraint_set& set_key(std::string key) { m_key = std::move(key); return *this; }
+                bool is_supported(int cap_value) const { return m_constraints.find(cap_value) != m_constraints.end(); }
+                bool empty() const noexcept { return m_constraints.empty(); }
+
+                const constraint* find(int cap_value) const
+                {
+                    auto iter = m_constraints.find(cap_value);
+                    return iter != m_constraints.end() ? &iter->second : nullptr;
+                }
+
+                /// Validates a single setting
+                validation_status validate(const capability_setting& setting) const
+                {
+                    auto pConstraint = find(setting.cap_value);
+                    if (!pConstraint)
+                        return validation_status::capability_not_supported;
+
+                    // resets, and sets with no values, are always allowed
+                    if (setting.operation != set_operation_type::SET ||
+                        (setting.values.numeric_values.empty() && setting.values.string_values.empty()))
+                        return validation_status::valid;
+                    if (!pConstraint->values_known)
+                        return validation_status::not_checked;
+
+                    const auto& numeric = setting.values.numeric_values;
+                    const auto& allowed = pConstraint->allowed.numeric_values;
+                    switch (pConstraint->container_type)
+                    {
+                        case twain_container_type::CONTAINER_RANGE:
+                        {
+                            if (allowed.size() < 2)
+                                return validation_status::not_checked;
+                            const bool ok = std::all_of(numeric.begin(), numeric.end(),
+                                                        [&](double val) { return is_value_in_range(val, allowed); });
+                            return ok ? validation_status::valid : validation_status::value_not_supported;
+                        }
+
+                        case twain_container_type::CONTAINER_ENUMERATION:
+                        case twain_container_type::CONTAINER_ARRAY:
+                        {
+                            const auto& strings = setting.values.string_values;
+                            const auto& allowed_strings = pConstraint->allowed.string_values;
+                            const bool numeric_ok = std::all_of(numeric.begin(), numeric.end(), [&](double val)
+                                    { return std::any_of(allowed.begin(), allowed.end(), [&](double a) { return is_value_close(a, val); }); });
+                            const bool strings_ok = std::all_of(strings.begin(), strings.end(), [&](const std::string& val)
+                                    { return std::find(allowed_strings.begin(), allowed_strings.end(), val) != allowed_strings.end(); });
+                            return (numeric_ok && strings_ok) ? validation_status::valid : validation_status::value_not_supported;
+                        }
+
+                        default:
+                            // a single value container only reports the current value, so the value cannot be checked
+                            return validation_status::not_checked;
+                    }
+                }
+
+                /// Validates all of the settings in one pass, without contacting the device.  If a capability is set more
+                /// than once, only the last setting is validated.
+                validation_report validate(const std::vector<capability_setting>& settings) const
+                {
+                    std::vector<validation_result> results;
+                    for (auto it = settings.rbegin(); it != settings.rend(); ++it)
+                    {
+                        if (std::any_of(results.begin(), results.end(),
+                                        [&](const validation_result& r) { return r.cap_value == it->cap_value; }))
+                            continue;
+                        validation_result r;
+                        r.cap_value = it->cap_value;
+                        r.status = validate(*it);
+                        r.requested = it->values;
+                        results.push_back(std::move(r));
+                    }
+                    std::reverse(results.begin(), results.end());
+                    return validation_report(std::move(results));
+                }
+
+                bool save(std::ostream& strm) const
+                {
+                    strm << constraint_header << " " << constraint_version << "\n";
+                    write_string(strm, m_productName);
+                    write_string(strm, m_key);
+                    strm << m_constraints.size() << "\n";
+                    for (auto& c : m_constraints)
+                    {
+                        strm << c.first << " " << c.second.container_type << " " << (c.second.values_known ? 1 : 0) << " ";
+                        c.second.allowed.write(strm);
+                        strm << "\n";
+                    }
+                    return strm.good();
+                }
+
+                bool load(std::istream& strm)
+                {
+                    capability_constraint_set cs;
+                    std::string token;
+                    int version = 0;
+                    size_t num_constraints = 0;
+                    if (!(strm >> token) || token != constraint_header || !(strm >> version) || version != constraint_version)
+                        return false;
+                    if (!read_string(strm, cs.m_productName) || !read_string(strm, cs.m_key))
+                        return false;
+                    if (!(strm >> num_constraints))
+                        return false;
+                    for (size_t i = 0; i < num_constraints; ++i)
+                    {
+                        int cap_value = 0;
+                        int values_known = 0;
+                        constraint c;
+                        if (!(strm >> cap_value >> c.container_type >> values_known) || !c.allowed.read(strm))
+                            return false;
+                        c.values_known = values_known != 0;
+                        cs.m_constraints.insert({ cap_value, std::move(c) });
+                    }
+                    *this = std::move(cs);
+                    return true;
+                }
+
+                bool save(const std::string& filename) const
+                {
+                    std::ofstream ofs(filename);
+                    return ofs && save(ofs);
+                }
+
+                bool load(const std::string& filename)
+                {
+                    std::ifstream ifs(filename);
+                    return ifs && load(ifs);
+                }
+        };
+    }
+}
+#endif
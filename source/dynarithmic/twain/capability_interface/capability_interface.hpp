@@ -26,11 +26,13 @@ OF THIRD PARTY RIGHTS.
 #define variant_type_ std::variant
 #define variant_get_ std::get
 #define variant_get_type_(v) (v).index() 
+#define variant_visit_ std::visit
 #else
 #include <boost/variant.hpp>
 #define variant_type_ boost::variant
 #define variant_get_ boost::get
 #define variant_get_type_(v) (v).which() 
+#define variant_visit_ boost::apply_visitor
 #endif
 
 #include <map>
@@ -40,11 +42,15 @@ OF THIRD PARTY RIGHTS.
 #include <memory>
 #include <vector>
 #include <algorithm>
+#include <functional>
 #include <set>
 #include "twain.h"
 #include <dynarithmic/twain/types/twain_capbasics.hpp>
 #include <dynarithmic/twain/types/twain_types.hpp>
 #include <dynarithmic/twain/types/twain_range.hpp>
+#include <dynarithmic/twain/types/twain_span.hpp>
+#include <dynarithmic/twain/types/twain_small_vector.hpp>
+#include <dynarithmic/twain/capability_interface/capability_snapshot.hpp>
 
 namespace dynarithmic {
 namespace twain {
@@ -194,9 +200,17 @@ namespace twain {
                           m_cap_cache(std::move(rhs.m_cap_cache)),
                           m_return_type(std::move(rhs.m_return_type)),
                           m_cacheable_set(std::move(rhs.m_cacheable_set)),
+                          m_cached_range_set(std::move(rhs.m_cached_range_set)),
+                          m_array_pool(std::move(rhs.m_array_pool)),
+                          m_pSetRecorder(rhs.m_pSetRecorder),
+                          m_bRecordOnly(rhs.m_bRecordOnly),
+                          m_nSetGeneration(rhs.m_nSetGeneration),
+                          m_cap_set_state(std::move(rhs.m_cap_set_state)),
+                          m_set_listener(std::move(rhs.m_set_listener)),
                           m_Source(rhs.m_Source)
         {
             rhs.m_Source = nullptr;
+            rhs.m_pSetRecorder = nullptr;
         }
 
         capability_interface& capability_interface::operator= (capability_interface&& rhs) noexcept
@@ -209,9 +223,17 @@ namespace twain {
                 m_extendedimage_caps = std::move(rhs.m_extendedimage_caps);
                 m_cap_cache = std::move(rhs.m_cap_cache);
                 m_cacheable_set = std::move(rhs.m_cacheable_set);
+                m_cached_range_set = std::move(rhs.m_cached_range_set);
+                m_array_pool = std::move(rhs.m_array_pool);
+                m_pSetRecorder = rhs.m_pSetRecorder;
+                m_bRecordOnly = rhs.m_bRecordOnly;
+                m_nSetGeneration = rhs.m_nSetGeneration;
+                m_cap_set_state = std::move(rhs.m_cap_set_state);
+                m_set_listener = std::move(rhs.m_set_listener);
                 m_return_type = rhs.m_return_type;
                 m_Source = rhs.m_Source;
                 rhs.m_Source = nullptr;
+                rhs.m_pSetRecorder = nullptr;
             }
             return *this;
         }
@@ -370,7 +392,25 @@ namespace twain {
         using cache_set_type = std::unordered_set<int>;
         mutable capability_cache m_cap_cache;
         cache_set_type m_cacheable_set;
+
+        // the cached capabilities whose values were returned as a range (minimum, maximum, step, ...)
+        mutable cache_set_type m_cached_range_set;
         mutable cap_return_type m_return_type;
+        mutable twain_array_pool m_array_pool;
+        mutable std::vector<capability_setting>* m_pSetRecorder = nullptr;
+        mutable bool m_bRecordOnly = false;
+        mutable uint64_t m_nSetGeneration = 0;
+
+        // the set generation at which each capability last changed value, and a hash of the value that was set
+        struct cap_set_state
+        {
+            uint64_t generation = 0;
+            uint64_t value_hash = 0;
+        };
+        mutable std::unordered_map<int, cap_set_state> m_cap_set_state;
+
+        // called with the capability after each successful set
+        std::function<void(int)> m_set_listener;
 
         struct capability_info_struct;
 
@@ -511,6 +551,10 @@ namespace twain {
                     return { true, DTWAIN_NO_ERROR };
             }
 
+            // while the capability sets are only being recorded, the device is not contacted
+            if (m_bRecordOnly)
+                return { false, DTWAIN_ERR_CAP_NO_SUPPORT };
+
             twain_array ta;
             bool retVal = API_INSTANCE DTWAIN_GetCapValues(m_Source, capvalue,
                 static_cast<LONG>(gcType.get_operation()), ta.get_array_ptr()) != 0;
@@ -520,7 +564,11 @@ namespace twain {
             const auto array_type = API_INSTANCE DTWAIN_GetCapArrayType(m_Source, capvalue);
             twain_array_copy_traits::copy_from_twain_array(ta, ta.get_count(), container);
             if (is_cache)
+            {
                 copy_to_cache(container, capvalue);
+                if (ta.is_range())
+                    m_cached_range_set.insert(capvalue);
+            }
             return { retVal, DTWAIN_NO_ERROR };
         }
 
@@ -530,6 +578,136 @@ namespace twain {
             return get_cap_values(C, T::cap_value, gcType);
         }
 
+        // converts a cached capability value to the type-neutral form used by capability_snapshot
+        struct snapshot_cache_visitor
+        {
+            typedef void result_type;
+            capability_snapshot::entry* m_pEntry;
+            snapshot_cache_visitor(capability_snapshot::entry* pEntry) : m_pEntry(pEntry) {}
+            template <typename T>
+            void operator()(const T& val) const { m_pEntry->numeric_values.push_back(static_cast<double>(val)); }
+            void operator()(const std::string& val) const { m_pEntry->string_values.push_back(val); }
+            void operator()(const twain_frame<double>& val) const { m_pEntry->frame_values.push_back(val); }
+        };
+
+        bool fill_snapshot_entry_from_cache(capability_snapshot::entry& e, int capvalue) const
+        {
+            auto iter = m_cap_cache.find(capvalue);
+            if (iter == m_cap_cache.end())
+                return false;
+            snapshot_cache_visitor visitor(&e);
+            for (auto& vt : iter->second)
+                variant_visit_(visitor, vt);
+            e.return_value = true;
+            e.error_code = DTWAIN_NO_ERROR;
+            e.from_cache = true;
+
+            // the container type is worked out the same way as for values retrieved from the device
+            e.container_type = get_known_container_type(capvalue, get_operation_type::GET);
+            e.is_range = e.container_type == twain_container_type::CONTAINER_RANGE ||
+                         m_cached_range_set.find(capvalue) != m_cached_range_set.end();
+            if (e.container_type == twain_container_type::CONTAINER_INVALID)
+                e.container_type = get_container_type_from_values(e.is_range, iter->second.size());
+            return true;
+        }
+
+        static LONG get_container_type_from_values(bool is_range, size_t count)
+        {
+            if (is_range)
+                return twain_container_type::CONTAINER_RANGE;
+            return count > 1 ? twain_container_type::CONTAINER_ENUMERATION : twain_container_type::CONTAINER_ONEVALUE;
+        }
+
+        // replaces the cached values of a capability with values retrieved from the device
+        template <typename Container>
+        void store_in_cache(const Container& ct, int capvalue, bool is_range) const
+        {
+            m_cap_cache.erase(capvalue);
+            copy_to_cache(ct, capvalue);
+            if (is_range)
+                m_cached_range_set.insert(capvalue);
+            else
+                m_cached_range_set.erase(capvalue);
+        }
+
+        // the container type of a get operation, if it has already been retrieved from the device, otherwise 0
+        LONG get_known_container_type(int capvalue, LONG operation) const
+        {
+            int idx = -1;
+            switch (operation)
+            {
+                case get_operation_type::GET:
+                    idx = 0;
+                break;
+                case get_operation_type::GET_CURRENT:
+                    idx = 1;
+                break;
+                case get_operation_type::GET_DEFAULT:
+                    idx = 2;
+                break;
+            }
+            auto iter = m_caps.find(capvalue);
+            if (idx == -1 || iter == m_caps.end() || iter->second.container_type[idx] == -1)
+                return twain_container_type::CONTAINER_INVALID;
+            return iter->second.container_type[idx];
+        }
+
+        // retrieves the values of a query from the device.  If **cache** is true, the values are also stored in the
+        // capability cache, as get_cap_values() does.
+        void fill_snapshot_entry(capability_snapshot::entry& e, const capability_query& query, bool cache) const
+        {
+            twain_array ta;
+            if (!API_INSTANCE DTWAIN_GetCapValues(m_Source, query.cap_value, query.operation, ta.get_array_ptr()))
+            {
+                e.error_code = API_INSTANCE DTWAIN_GetLastError();
+                return;
+            }
+            e.return_value = true;
+            e.error_code = DTWAIN_NO_ERROR;
+            e.is_range = ta.is_range();
+
+            // the container type is taken from the returned values instead of asking the device for it separately.
+            // A single value is reported as a one-value container, even if the device returned an enumeration.
+            e.container_type = get_known_container_type(query.cap_value, query.operation);
+            if (e.container_type == twain_container_type::CONTAINER_INVALID)
+                e.container_type = get_container_type_from_values(e.is_range, ta.get_count());
+
+            auto iter = m_caps.find(query.cap_value);
+            const long data_type = (iter != m_caps.end()) ? iter->second.data_type :
+                                                            API_INSTANCE DTWAIN_GetCapDataType(m_Source, query.cap_value);
+            switch (data_type)
+            {
+                case TWTY_STR32:
+                case TWTY_STR64:
+                case TWTY_STR128:
+                case TWTY_STR255:
+                case TWTY_STR1024:
+                    twain_array_copy_traits::copy_from_twain_array(ta, e.string_values);
+                    if (cache)
+                        store_in_cache(e.string_values, query.cap_value, e.is_range);
+                break;
+                case TWTY_FRAME:
+                    twain_array_copy_traits::copy_from_twain_array(ta, e.frame_values);
+                    if (cache)
+                        store_in_cache(e.frame_values, query.cap_value, e.is_range);
+                break;
+                case TWTY_FIX32:
+                    twain_array_copy_traits::copy_from_twain_array(ta, e.numeric_values);
+                    if (cache)
+                        store_in_cache(e.numeric_values, query.cap_value, e.is_range);
+                break;
+                default:
+                {
+                    std::vector<LONG> vals;
+                    twain_array_copy_traits::copy_from_twain_array(ta, vals);
+                    e.numeric_values.assign(vals.begin(), vals.end());
+                    if (cache)
+                        store_in_cache(vals, query.cap_value, e.is_range);
+                }
+                break;
+            }
+        }
+
     public:
         typedef source_cap_info::value_type value_type;
         typedef std::string camera_name_type;
@@ -710,27 +888,205 @@ namespace twain {
             const auto theSource = m_Source;
             if (!theSource)
                 return {false, DTWAIN_ERR_BAD_SOURCE};
-            if (!m_caps.empty() && m_caps.find(capvalue) == m_caps.end())
+            const bool is_supported = m_caps.empty() || m_caps.find(capvalue) != m_caps.end();
+            if (m_pSetRecorder)
+            {
+                capability_setting setting;
+                setting.cap_value = capvalue;
+                setting.operation = scType.get_operation();
+                setting.values.assign(C);
+                m_pSetRecorder->push_back(std::move(setting));
+                if (m_bRecordOnly)
+                    return {is_supported, is_supported ? DTWAIN_NO_ERROR : DTWAIN_ERR_CAP_NO_SUPPORT};
+            }
+            if (!is_supported)
                 return {false, DTWAIN_ERR_CAP_NO_SUPPORT};
 
-            twain_array ta;
-            const auto array_type = API_INSTANCE DTWAIN_GetCapArrayType(theSource, capvalue);
-            twain_array_copy_traits::copy_to_twain_array(theSource, ta, capvalue, C);
+            // borrow an array of the correct type from the pool instead of creating one on each call
+            auto ta = m_array_pool.acquire(theSource, capvalue, C.size());
+            if (!ta)
+                return {false, API_INSTANCE DTWAIN_GetLastError()};
+            twain_array_copy_traits::fill_twain_array(ta.get(), C);
             auto retval = API_INSTANCE DTWAIN_SetCapValues(theSource, capvalue, static_cast<LONG>(scType.get_operation()),
                                                 ta.get_array());
-            LONG last_error = DTWAIN_NO_ERROR;
             if (!retval)
-                last_error = API_INSTANCE DTWAIN_GetLastError();
-            return {retval ? true : false, last_error};
+                return {false, API_INSTANCE DTWAIN_GetLastError()};
+
+            // remember when the capability changed value, so that information derived from it can be invalidated.  A set
+            // that the device rejected leaves the value unchanged.
+            ++m_nSetGeneration;
+            const auto value_hash = capability_values_hash(scType.get_operation(), C);
+            auto& state = m_cap_set_state[capvalue];
+            if (state.generation == 0 || state.value_hash != value_hash)
+            {
+                state.generation = m_nSetGeneration;
+                state.value_hash = value_hash;
+            }
+            if (m_set_listener)
+                m_set_listener(capvalue);
+            return {true, DTWAIN_NO_ERROR};
         }
 
-        template <typename T, typename Container = std::vector<typename T::value_type>>
+        /// Sets the values of a capability.
+        ///
+        /// The container defaults to a twain_span, so that values given as a braced list (for example,
+        /// <b>set_cap_values&lt;ICAP_PIXELTYPE_&gt;({ DTWAIN_PT_RGB })</b>) are set without allocating memory.
+        template <typename T, typename Container = twain_span<typename T::value_type>>
         cap_return_type set_cap_values(const Container& C, const setcap_operation_info& scType = setcap_operation_info()) const
         {
             static_assert(std::is_same<typename T::value_type, typename Container::value_type>::value == 1,
                             "Capability type does not match container value type");
             return set_cap_values(C, T::cap_value, scType);
         }
+
+        /// Sets a capability to a single value, without allocating memory
+        template <typename T>
+        cap_return_type set_cap_value(const typename T::value_type& value, const setcap_operation_info& scType = setcap_operation_info()) const
+        {
+            return set_cap_values(twain_span<typename T::value_type>::of(value), T::cap_value, scType);
+        }
+
+        /// Applies a capability_setting, converting the values to the data type of the capability.
+        ///
+        /// @param[in] setting The setting to apply, for example one recorded with begin_recording()
+        /// @param[in] data_type The TWAIN data type of the capability.  If -1, the data type that the source reports is used.
+        cap_return_type apply_setting(const capability_setting& setting, long data_type = -1) const
+        {
+            if (data_type == -1)
+            {
+                auto iter = m_caps.find(setting.cap_value);
+                data_type = (iter != m_caps.end()) ? iter->second.data_type : TWTY_INT32;
+            }
+            const auto scType = setcap_operation_info().set_setter_type(setting.operation);
+            const auto& values = setting.values;
+            if (is_string_type(data_type))
+                return set_cap_values(values.string_values, setting.cap_value, scType);
+            if (is_frame_type(data_type))
+                return set_cap_values(values.frame_values, setting.cap_value, scType);
+            if (is_fix32_type(data_type))
+                return set_cap_values(values.numeric_values, setting.cap_value, scType);
+            twain_small_vector<LONG> long_values(values.numeric_values.begin(), values.numeric_values.end());
+            return set_cap_values(long_values, setting.cap_value, scType);
+        }
+
+        /// Starts recording the capability set operations made through this interface.
+        ///
+        /// @param[in] pRecorder The vector that receives each capability_setting, in the order that the sets are made
+        /// @param[in] record_only If **true**, the settings are only recorded, and the device is not contacted.  Capability
+        /// values retrieved while recording are only returned if they are in the capability cache.
+        /// @note Sets of capabilities that the source does not support are also recorded, so that the recorded settings can
+        /// be validated.  Call end_recording() to stop recording.
+        void begin_recording(std::vector<capability_setting>* pRecorder, bool record_only = false) const
+        {
+            m_pSetRecorder = pRecorder;
+            m_bRecordOnly = record_only;
+        }
+
+        void end_recording() const
+        {
+            m_pSetRecorder = nullptr;
+            m_bRecordOnly = false;
+        }
+
+        /// Sets the function that is called with the capability after each capability is successfully set on the device.
+        /// An empty function removes the listener.
+        void set_set_listener(std::function<void(int)> fn) { m_set_listener = std::move(fn); }
+
+        /// Returns a counter that is incremented each time a capability is successfully set on the device.  The value can be used to
+        /// detect whether any capability has been changed since a previous point in time.
+        uint64_t get_set_generation() const noexcept { return m_nSetGeneration; }
+
+        /// Discards what is known about the values of the device's capabilities, after the device state was replaced as
+        /// a whole (for example, by setting CAP_CUSTOMDSDATA).
+        ///
+        /// The capability cache is cleared, and the set generation of the interface and of every capability that was set
+        /// is advanced, so that information derived from the capabilities is retrieved again.
+        void invalidate_device_state() const
+        {
+            ++m_nSetGeneration;
+            m_cap_cache.clear();
+            m_cached_range_set.clear();
+            for (auto& state : m_cap_set_state)
+            {
+                // the value on the device is not known, so the next set of any value counts as a change
+                state.second.generation = m_nSetGeneration;
+                state.second.value_hash = 0;
+            }
+        }
+
+        /// Returns the set generation at which any of the capabilities in **caps** last changed value.
+        ///
+        /// Setting a capability to the value it was last set to does not change its generation.  Information derived from
+        /// the capabilities only needs to be retrieved again if this value changes.
+        /// @returns The latest set generation of the capabilities, or 0 if none of them have been set.
+        template <typename Container>
+        uint64_t get_cap_set_generation(const Container& caps) const
+        {
+            uint64_t generation = 0;
+            for (auto cap : caps)
+            {
+                auto iter = m_cap_set_state.find(cap);
+                if (iter != m_cap_set_state.end())
+                    generation = (std::max)(generation, iter->second.generation);
+            }
+            return generation;
+        }
+
+        /// Retrieves the values of multiple capabilities in one call.
+        ///
+        /// The queries are sorted and duplicates are removed, so that each (capability, operation) pair results in at most
+        /// one call to the device.  Plain get() queries for cacheable capabilities are satisfied from the capability cache
+        /// when possible, and the values retrieved from the device for them are stored in the cache, as get_cap_values()
+        /// does.  Capabilities that the source does not support, and queries that the cache cannot satisfy while the
+        /// capability sets are only being recorded, are recorded as failed entries without contacting the device.
+        /// @param[in] queries The list of capabilities and get operations to retrieve
+        ///
+        /// @returns An immutable capability_snapshot holding the results of each query
+        /// @note The number of device calls and cache hits is available from the returned snapshot, and is written to the
+        /// DTWAIN log.
+        capability_snapshot get_snapshot(std::vector<capability_query> queries) const
+        {
+            const size_t num_requested = queries.size();
+            std::sort(queries.begin(), queries.end());
+            queries.erase(std::unique(queries.begin(), queries.end()), queries.end());
+
+            capability_snapshot::entry_map entries;
+            size_t driver_calls = 0;
+            size_t cache_hits = 0;
+            for (auto& q : queries)
+            {
+                capability_snapshot::entry e;
+                const bool is_cache = q.operation == get_operation_type::GET &&
+                                      m_cacheable_set.find(q.cap_value) != m_cacheable_set.end();
+                if (!m_Source)
+                    e.error_code = DTWAIN_ERR_BAD_SOURCE;
+                else
+                if (!m_caps.empty() && m_caps.find(q.cap_value) == m_caps.end())
+                    e.error_code = DTWAIN_ERR_CAP_NO_SUPPORT;
+                else
+                if (is_cache && fill_snapshot_entry_from_cache(e, q.cap_value))
+                    ++cache_hits;
+                else
+                if (m_bRecordOnly)
+                    e.error_code = DTWAIN_ERR_CAP_NO_SUPPORT;
+                else
+                {
+                    fill_snapshot_entry(e, q, is_cache);
+                    e.from_device = true;
+                    ++driver_calls;
+                }
+                entries.insert({ q, std::move(e) });
+            }
+
+            if (m_Source)
+            {
+                const std::string msg = "capability snapshot: " + std::to_string(num_requested) + " requested, " +
+                                         std::to_string(queries.size()) + " unique, " + std::to_string(driver_calls) +
+                                         " device calls, " + std::to_string(cache_hits) + " cache hits";
+                API_INSTANCE DTWAIN_LogMessageA(msg.c_str());
+            }
+            return capability_snapshot(std::move(entries), num_requested, driver_calls, cache_hits);
+        }
             
         ///////////////////////////////////////////////////////////////////////////////////////////////
         template <typename CapType>
@@ -884,12 +1240,12 @@ namespace twain {
         }
 
 
-        template <typename Container=std::vector<uint16_t>>
+        template <typename Container=twain_span<uint16_t>>
         capability_interface& set_custom(int cap, const Container& ct, const setcap_operation_info& setType = setcap_operation_info())
         {
             if (std::is_same<Container::value_type, bool>::value)
             {
-                std::vector<uint16_t> ctTemp;
+                twain_small_vector<uint16_t> ctTemp;
                 std::copy(ct.begin(), ct.end(), std::back_inserter(ctTemp));
                 if (ctTemp.empty())
                     m_return_type = set_cap_values(ctTemp, cap, reset());
@@ -1121,7 +1477,10 @@ namespace twain {
         {
             m_Source = nullptr;
             m_cap_cache.clear();
+            m_cached_range_set.clear();
             m_cacheable_set.clear();
+            m_array_pool.clear();
+            m_cap_set_state.clear();
         }
         
         template <typename T>
@@ -1373,144 +1732,144 @@ namespace twain {
         template <typename Container = std::vector<ICAP_YSCALING_::value_type>> Container get_yscaling(const getcap_operation_info& gcType = getcap_operation_info()) const { Container ct {}; m_return_type = get_caps_impl<Container, ICAP_YSCALING_>(ct, gcType); return ct; }
         template <typename Container = std::vector<ICAP_ZOOMFACTOR_::value_type>> Container get_zoomfactor(const getcap_operation_info& gcType = getcap_operation_info()) const { Container ct {}; m_return_type = get_caps_impl<Container, ICAP_ZOOMFACTOR_>(ct, gcType); return ct; }
 
-        template <typename Container = std::vector<ACAP_XFERMECH_::value_type>> const capability_interface& set_audio_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ACAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container, ACAP_XFERMECH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_ALARMS_::value_type>> const capability_interface& set_alarms(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ALARMS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ALARMS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_ALARMVOLUME_::value_type>> const capability_interface& set_alarmvolume(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ALARMVOLUME_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ALARMVOLUME_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_AUTHOR_::value_type>> const capability_interface& set_author(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTHOR_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTHOR_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_AUTOFEED_::value_type>> const capability_interface& set_autofeed(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOFEED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOFEED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_AUTOMATICCAPTURE_::value_type>> const capability_interface& set_automaticcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOMATICCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOMATICCAPTURE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_AUTOMATICSENSEMEDIUM_::value_type>> const capability_interface& set_automaticsensemedium(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOMATICSENSEMEDIUM_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOMATICSENSEMEDIUM_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_AUTOSCAN_::value_type>> const capability_interface& set_autoscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOSCAN_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_CAMERAENABLED_::value_type>> const capability_interface& set_cameraenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERAENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERAENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_CAMERAORDER_::value_type>> const capability_interface& set_cameraorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERAORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERAORDER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_CAMERASIDE_::value_type>> const capability_interface& set_cameraside(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERASIDE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERASIDE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_CAPTION_::value_type>> const capability_interface& set_caption(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAPTION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAPTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_CLEARPAGE_::value_type>> const capability_interface& set_clearpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CLEARPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CLEARPAGE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DEVICEEVENT_::value_type>> const capability_interface& set_deviceevent(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DEVICEEVENT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DEVICEEVENT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DEVICETIMEDATE_::value_type>> const capability_interface& set_devicetimedate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DEVICETIMEDATE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DEVICETIMEDATE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DOUBLEFEEDDETECTION_::value_type>> const capability_interface& set_doublefeeddetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DOUBLEFEEDDETECTIONLENGTH_::value_type>> const capability_interface& set_doublefeeddetectionlength(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONLENGTH_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONLENGTH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DOUBLEFEEDDETECTIONRESPONSE_::value_type>> const capability_interface& set_doublefeeddetectionresponse(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONRESPONSE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONRESPONSE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DOUBLEFEEDDETECTIONSENSITIVITY_::value_type>> const capability_interface& set_doublefeeddetectionsensitivity(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_DUPLEXENABLED_::value_type>> const capability_interface& set_duplexenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DUPLEXENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DUPLEXENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_ENDORSER_::value_type>> const capability_interface& set_endorser(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ENDORSER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ENDORSER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_EXTENDEDCAPS_::value_type>> const capability_interface& set_extendedcaps(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_EXTENDEDCAPS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_EXTENDEDCAPS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDERALIGNMENT_::value_type>> const capability_interface& set_feederalignment(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERALIGNMENT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERALIGNMENT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDERENABLED_::value_type>> const capability_interface& set_feederenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDERORDER_::value_type>> const capability_interface& set_feederorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERORDER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDERPOCKET_::value_type>> const capability_interface& set_feederpocket(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERPOCKET_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERPOCKET_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDERPREP_::value_type>> const capability_interface& set_feederprep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERPREP_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERPREP_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_FEEDPAGE_::value_type>> const capability_interface& set_feedpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDPAGE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_INDICATORS_::value_type>> const capability_interface& set_indicators(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_INDICATORS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_INDICATORS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_INDICATORSMODE_::value_type>> const capability_interface& set_indicatorsmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_INDICATORSMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_INDICATORSMODE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_JOBCONTROL_::value_type>> const capability_interface& set_jobcontrol(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_JOBCONTROL_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_JOBCONTROL_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_LANGUAGE_::value_type>> const capability_interface& set_language(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_LANGUAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_LANGUAGE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_MAXBATCHBUFFERS_::value_type>> const capability_interface& set_maxbatchbuffers(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_MAXBATCHBUFFERS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_MAXBATCHBUFFERS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_MICRENABLED_::value_type>> const capability_interface& set_micrenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_MICRENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_MICRENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PAPERHANDLING_::value_type>> const capability_interface& set_paperhandling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PAPERHANDLING_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PAPERHANDLING_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_POWERSAVETIME_::value_type>> const capability_interface& set_powersavetime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_POWERSAVETIME_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_POWERSAVETIME_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTER_::value_type>> const capability_interface& set_printer(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERCHARROTATION_::value_type>> const capability_interface& set_printercharrotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERCHARROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERCHARROTATION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERENABLED_::value_type>> const capability_interface& set_printerenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERFONTSTYLE_::value_type>> const capability_interface& set_printerfontstyle(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERFONTSTYLE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERFONTSTYLE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEX_::value_type>> const capability_interface& set_printerindex(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEX_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEX_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEXLEADCHAR_::value_type>> const capability_interface& set_printerindexleadchar(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXLEADCHAR_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXLEADCHAR_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEXMAXVALUE_::value_type>> const capability_interface& set_printerindexmaxvalue(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXMAXVALUE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXMAXVALUE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEXNUMDIGITS_::value_type>> const capability_interface& set_printerindexnumdigits(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXNUMDIGITS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXNUMDIGITS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEXSTEP_::value_type>> const capability_interface& set_printerindexstep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXSTEP_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXSTEP_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERINDEXTRIGGER_::value_type>> const capability_interface& set_printerindextrigger(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXTRIGGER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXTRIGGER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERMODE_::value_type>> const capability_interface& set_printermode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERMODE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERSTRING_::value_type>> const capability_interface& set_printerstring(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERSTRING_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERSTRING_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERSUFFIX_::value_type>> const capability_interface& set_printersuffix(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERSUFFIX_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERSUFFIX_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_PRINTERVERTICALOFFSET_::value_type>> const capability_interface& set_printerverticaloffset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERVERTICALOFFSET_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERVERTICALOFFSET_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_REWINDPAGE_::value_type>> const capability_interface& set_rewindpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_REWINDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_REWINDPAGE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_SEGMENTED_::value_type>> const capability_interface& set_segmented(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SEGMENTED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SEGMENTED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_SHEETCOUNT_::value_type>> const capability_interface& set_sheetcount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SHEETCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SHEETCOUNT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_SUPPORTEDCAPSSEGMENTUNIQUE_::value_type>> const capability_interface& set_supportedcapssegmentunique(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_THUMBNAILSENABLED_::value_type>> const capability_interface& set_thumbnailsenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_THUMBNAILSENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_THUMBNAILSENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_TIMEBEFOREFIRSTCAPTURE_::value_type>> const capability_interface& set_timebeforefirstcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_TIMEBEFOREFIRSTCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_TIMEBEFOREFIRSTCAPTURE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_TIMEBETWEENCAPTURES_::value_type>> const capability_interface& set_timebetweencaptures(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_TIMEBETWEENCAPTURES_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_TIMEBETWEENCAPTURES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<CAP_XFERCOUNT_::value_type>> const capability_interface& set_xfercount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_XFERCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_XFERCOUNT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOBRIGHT_::value_type>> const capability_interface& set_autobright(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOBRIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOBRIGHT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTODISCARDBLANKPAGES_::value_type>> const capability_interface& set_autodiscardblankpages(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTODISCARDBLANKPAGES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTODISCARDBLANKPAGES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICBORDERDETECTION_::value_type>> const capability_interface& set_automaticborderdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICBORDERDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICBORDERDETECTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICCOLORENABLED_::value_type>> const capability_interface& set_automaticcolorenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_::value_type>> const capability_interface& set_automaticcolornoncolorpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICDESKEW_::value_type>> const capability_interface& set_automaticdeskew(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICDESKEW_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICDESKEW_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICLENGTHDETECTION_::value_type>> const capability_interface& set_automaticlengthdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICLENGTHDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICLENGTHDETECTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOMATICROTATE_::value_type>> const capability_interface& set_automaticrotate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICROTATE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICROTATE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_AUTOSIZE_::value_type>> const capability_interface& set_autosize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOSIZE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOSIZE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODEDETECTIONENABLED_::value_type>> const capability_interface& set_barcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEDETECTIONENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODEMAXRETRIES_::value_type>> const capability_interface& set_barcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXRETRIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODESEARCHMODE_::value_type>> const capability_interface& set_barcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHMODE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHPRIORITIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BARCODETIMEOUT_::value_type>> const capability_interface& set_barcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODETIMEOUT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BITDEPTH_::value_type>> const capability_interface& set_bitdepth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITDEPTH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITDEPTH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BITDEPTHREDUCTION_::value_type>> const capability_interface& set_bitdepthreduction(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITDEPTHREDUCTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITDEPTHREDUCTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BITORDER_::value_type>> const capability_interface& set_bitorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITORDER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BITORDERCODES_::value_type>> const capability_interface& set_bitordercodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITORDERCODES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITORDERCODES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_BRIGHTNESS_::value_type>> const capability_interface& set_brightness(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BRIGHTNESS_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BRIGHTNESS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_CCITTKFACTOR_::value_type>> const capability_interface& set_ccittkfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CCITTKFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CCITTKFACTOR_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_COLORMANAGEMENTENABLED_::value_type>> const capability_interface& set_colormanagementenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_COLORMANAGEMENTENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_COLORMANAGEMENTENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_COMPRESSION_::value_type>> const capability_interface& set_compression(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_COMPRESSION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_COMPRESSION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_CONTRAST_::value_type>> const capability_interface& set_contrast(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CONTRAST_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CONTRAST_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_CUSTHALFTONE_::value_type>> const capability_interface& set_custhalftone(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CUSTHALFTONE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CUSTHALFTONE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_EXPOSURETIME_::value_type>> const capability_interface& set_exposuretime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_EXPOSURETIME_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_EXPOSURETIME_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_EXTIMAGEINFO_::value_type>> const capability_interface& set_extimageinfo(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_EXTIMAGEINFO_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_EXTIMAGEINFO_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FEEDERTYPE_::value_type>> const capability_interface& set_feedertype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FEEDERTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FEEDERTYPE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FILMTYPE_::value_type>> const capability_interface& set_filmtype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FILMTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FILMTYPE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FILTER_::value_type>> const capability_interface& set_filter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FILTER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FLASHUSED_::value_type>> const capability_interface& set_flashused(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLASHUSED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLASHUSED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FLASHUSED2_::value_type>> const capability_interface& set_flashused2(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLASHUSED2_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLASHUSED2_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FLIPROTATION_::value_type>> const capability_interface& set_fliprotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLIPROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLIPROTATION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_FRAMES_::value_type>> const capability_interface& set_frames(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FRAMES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_GAMMA_::value_type>> const capability_interface& set_gamma(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_GAMMA_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_GAMMA_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_HALFTONES_::value_type>> const capability_interface& set_halftones(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_HALFTONES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_HALFTONES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_HIGHLIGHT_::value_type>> const capability_interface& set_highlight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_HIGHLIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_HIGHLIGHT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_ICCPROFILE_::value_type>> const capability_interface& set_iccprofile(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ICCPROFILE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ICCPROFILE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_IMAGEDATASET_::value_type>> const capability_interface& set_imagedataset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEDATASET_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEDATASET_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_IMAGEFILEFORMAT_::value_type>> const capability_interface& set_imagefileformat(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEFILEFORMAT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEFILEFORMAT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_IMAGEFILTER_::value_type>> const capability_interface& set_imagefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEFILTER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_IMAGEMERGE_::value_type>> const capability_interface& set_imagemerge(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_IMAGEMERGEHEIGHTTHRESHOLD_::value_type>> const capability_interface& set_imagemergeheightthreshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_JPEGPIXELTYPE_::value_type>> const capability_interface& set_jpegpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGPIXELTYPE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_JPEGQUALITY_::value_type>> const capability_interface& set_jpegquality(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGQUALITY_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGQUALITY_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_JPEGSUBSAMPLING_::value_type>> const capability_interface& set_jpegsubsampling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGSUBSAMPLING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGSUBSAMPLING_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_LAMPSTATE_::value_type>> const capability_interface& set_lampstate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LAMPSTATE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LAMPSTATE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_LIGHTPATH_::value_type>> const capability_interface& set_lightpath(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LIGHTPATH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LIGHTPATH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_LIGHTSOURCE_::value_type>> const capability_interface& set_lightsource(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LIGHTSOURCE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LIGHTSOURCE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_MAXFRAMES_::value_type>> const capability_interface& set_maxframes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MAXFRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MAXFRAMES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_MINIMUMHEIGHT_::value_type>> const capability_interface& set_minimumheight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MINIMUMHEIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MINIMUMHEIGHT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_MINIMUMWIDTH_::value_type>> const capability_interface& set_minimumwidth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MINIMUMWIDTH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MINIMUMWIDTH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_MIRROR_::value_type>> const capability_interface& set_mirror(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MIRROR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MIRROR_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_NOISEFILTER_::value_type>> const capability_interface& set_noisefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_NOISEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_NOISEFILTER_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_ORIENTATION_::value_type>> const capability_interface& set_orientation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ORIENTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ORIENTATION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_OVERSCAN_::value_type>> const capability_interface& set_overscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_OVERSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_OVERSCAN_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODEDETECTIONENABLED_::value_type>> const capability_interface& set_patchcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEDETECTIONENABLED_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODEMAXRETRIES_::value_type>> const capability_interface& set_patchcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXRETRIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODESEARCHMODE_::value_type>> const capability_interface& set_patchcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHMODE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHPRIORITIES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PATCHCODETIMEOUT_::value_type>> const capability_interface& set_patchcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODETIMEOUT_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PIXELFLAVOR_::value_type>> const capability_interface& set_pixelflavor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVOR_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PIXELFLAVORCODES_::value_type>> const capability_interface& set_pixelflavorcodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVORCODES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVORCODES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PIXELTYPE_::value_type>> const capability_interface& set_pixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELTYPE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_PLANARCHUNKY_::value_type>> const capability_interface& set_planarchunky(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PLANARCHUNKY_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PLANARCHUNKY_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_ROTATION_::value_type>> const capability_interface& set_rotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ROTATION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_SHADOW_::value_type>> const capability_interface& set_shadow(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_SHADOW_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_SHADOW_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_SUPPORTEDSIZES_::value_type>> const capability_interface& set_supportedsizes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_SUPPORTEDSIZES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_SUPPORTEDSIZES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_THRESHOLD_::value_type>> const capability_interface& set_threshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_THRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_THRESHOLD_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_TILES_::value_type>> const capability_interface& set_tiles(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_TILES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_TILES_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_TIMEFILL_::value_type>> const capability_interface& set_timefill(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_TIMEFILL_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_TIMEFILL_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_UNDEFINEDIMAGESIZE_::value_type>> const capability_interface& set_undefinedimagesize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_UNDEFINEDIMAGESIZE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_UNDEFINEDIMAGESIZE_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_UNITS_::value_type>> const capability_interface& set_units(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_UNITS_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_UNITS_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_XFERMECH_::value_type>> const capability_interface& set_image_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XFERMECH_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_XRESOLUTION_::value_type>> const capability_interface& set_xresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XRESOLUTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_XSCALING_::value_type>> const capability_interface& set_xscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XSCALING_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_YRESOLUTION_::value_type>> const capability_interface& set_yresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_YRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_YRESOLUTION_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_YSCALING_::value_type>> const capability_interface& set_yscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_YSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_YSCALING_>({}, reset()); return *this; }
-        template <typename Container = std::vector<ICAP_ZOOMFACTOR_::value_type>> const capability_interface& set_zoomfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ZOOMFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ZOOMFACTOR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ACAP_XFERMECH_::value_type>> const capability_interface& set_audio_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ACAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container, ACAP_XFERMECH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_ALARMS_::value_type>> const capability_interface& set_alarms(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ALARMS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ALARMS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_ALARMVOLUME_::value_type>> const capability_interface& set_alarmvolume(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ALARMVOLUME_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ALARMVOLUME_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_AUTHOR_::value_type>> const capability_interface& set_author(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTHOR_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTHOR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_AUTOFEED_::value_type>> const capability_interface& set_autofeed(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOFEED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOFEED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_AUTOMATICCAPTURE_::value_type>> const capability_interface& set_automaticcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOMATICCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOMATICCAPTURE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_AUTOMATICSENSEMEDIUM_::value_type>> const capability_interface& set_automaticsensemedium(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOMATICSENSEMEDIUM_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOMATICSENSEMEDIUM_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_AUTOSCAN_::value_type>> const capability_interface& set_autoscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_AUTOSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_AUTOSCAN_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_CAMERAENABLED_::value_type>> const capability_interface& set_cameraenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERAENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERAENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_CAMERAORDER_::value_type>> const capability_interface& set_cameraorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERAORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERAORDER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_CAMERASIDE_::value_type>> const capability_interface& set_cameraside(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAMERASIDE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAMERASIDE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_CAPTION_::value_type>> const capability_interface& set_caption(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CAPTION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CAPTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_CLEARPAGE_::value_type>> const capability_interface& set_clearpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_CLEARPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_CLEARPAGE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DEVICEEVENT_::value_type>> const capability_interface& set_deviceevent(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DEVICEEVENT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DEVICEEVENT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DEVICETIMEDATE_::value_type>> const capability_interface& set_devicetimedate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DEVICETIMEDATE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DEVICETIMEDATE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DOUBLEFEEDDETECTION_::value_type>> const capability_interface& set_doublefeeddetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DOUBLEFEEDDETECTIONLENGTH_::value_type>> const capability_interface& set_doublefeeddetectionlength(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONLENGTH_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONLENGTH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DOUBLEFEEDDETECTIONRESPONSE_::value_type>> const capability_interface& set_doublefeeddetectionresponse(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONRESPONSE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONRESPONSE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DOUBLEFEEDDETECTIONSENSITIVITY_::value_type>> const capability_interface& set_doublefeeddetectionsensitivity(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_DUPLEXENABLED_::value_type>> const capability_interface& set_duplexenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_DUPLEXENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_DUPLEXENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_ENDORSER_::value_type>> const capability_interface& set_endorser(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_ENDORSER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_ENDORSER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_EXTENDEDCAPS_::value_type>> const capability_interface& set_extendedcaps(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_EXTENDEDCAPS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_EXTENDEDCAPS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDERALIGNMENT_::value_type>> const capability_interface& set_feederalignment(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERALIGNMENT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERALIGNMENT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDERENABLED_::value_type>> const capability_interface& set_feederenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDERORDER_::value_type>> const capability_interface& set_feederorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERORDER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDERPOCKET_::value_type>> const capability_interface& set_feederpocket(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERPOCKET_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERPOCKET_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDERPREP_::value_type>> const capability_interface& set_feederprep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDERPREP_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDERPREP_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_FEEDPAGE_::value_type>> const capability_interface& set_feedpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_FEEDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_FEEDPAGE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_INDICATORS_::value_type>> const capability_interface& set_indicators(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_INDICATORS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_INDICATORS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_INDICATORSMODE_::value_type>> const capability_interface& set_indicatorsmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_INDICATORSMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_INDICATORSMODE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_JOBCONTROL_::value_type>> const capability_interface& set_jobcontrol(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_JOBCONTROL_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_JOBCONTROL_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_LANGUAGE_::value_type>> const capability_interface& set_language(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_LANGUAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_LANGUAGE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_MAXBATCHBUFFERS_::value_type>> const capability_interface& set_maxbatchbuffers(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_MAXBATCHBUFFERS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_MAXBATCHBUFFERS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_MICRENABLED_::value_type>> const capability_interface& set_micrenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_MICRENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_MICRENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PAPERHANDLING_::value_type>> const capability_interface& set_paperhandling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PAPERHANDLING_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PAPERHANDLING_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_POWERSAVETIME_::value_type>> const capability_interface& set_powersavetime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_POWERSAVETIME_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_POWERSAVETIME_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTER_::value_type>> const capability_interface& set_printer(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERCHARROTATION_::value_type>> const capability_interface& set_printercharrotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERCHARROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERCHARROTATION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERENABLED_::value_type>> const capability_interface& set_printerenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERFONTSTYLE_::value_type>> const capability_interface& set_printerfontstyle(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERFONTSTYLE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERFONTSTYLE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEX_::value_type>> const capability_interface& set_printerindex(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEX_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEX_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEXLEADCHAR_::value_type>> const capability_interface& set_printerindexleadchar(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXLEADCHAR_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXLEADCHAR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEXMAXVALUE_::value_type>> const capability_interface& set_printerindexmaxvalue(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXMAXVALUE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXMAXVALUE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEXNUMDIGITS_::value_type>> const capability_interface& set_printerindexnumdigits(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXNUMDIGITS_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXNUMDIGITS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEXSTEP_::value_type>> const capability_interface& set_printerindexstep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXSTEP_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXSTEP_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERINDEXTRIGGER_::value_type>> const capability_interface& set_printerindextrigger(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXTRIGGER_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERINDEXTRIGGER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERMODE_::value_type>> const capability_interface& set_printermode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERMODE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERSTRING_::value_type>> const capability_interface& set_printerstring(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERSTRING_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERSTRING_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERSUFFIX_::value_type>> const capability_interface& set_printersuffix(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERSUFFIX_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERSUFFIX_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_PRINTERVERTICALOFFSET_::value_type>> const capability_interface& set_printerverticaloffset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_PRINTERVERTICALOFFSET_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_PRINTERVERTICALOFFSET_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_REWINDPAGE_::value_type>> const capability_interface& set_rewindpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_REWINDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_REWINDPAGE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_SEGMENTED_::value_type>> const capability_interface& set_segmented(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SEGMENTED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SEGMENTED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_SHEETCOUNT_::value_type>> const capability_interface& set_sheetcount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SHEETCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SHEETCOUNT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_SUPPORTEDCAPSSEGMENTUNIQUE_::value_type>> const capability_interface& set_supportedcapssegmentunique(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_THUMBNAILSENABLED_::value_type>> const capability_interface& set_thumbnailsenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_THUMBNAILSENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_THUMBNAILSENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_TIMEBEFOREFIRSTCAPTURE_::value_type>> const capability_interface& set_timebeforefirstcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_TIMEBEFOREFIRSTCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_TIMEBEFOREFIRSTCAPTURE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_TIMEBETWEENCAPTURES_::value_type>> const capability_interface& set_timebetweencaptures(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_TIMEBETWEENCAPTURES_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_TIMEBETWEENCAPTURES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<CAP_XFERCOUNT_::value_type>> const capability_interface& set_xfercount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, CAP_XFERCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container, CAP_XFERCOUNT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOBRIGHT_::value_type>> const capability_interface& set_autobright(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOBRIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOBRIGHT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTODISCARDBLANKPAGES_::value_type>> const capability_interface& set_autodiscardblankpages(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTODISCARDBLANKPAGES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTODISCARDBLANKPAGES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICBORDERDETECTION_::value_type>> const capability_interface& set_automaticborderdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICBORDERDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICBORDERDETECTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICCOLORENABLED_::value_type>> const capability_interface& set_automaticcolorenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_::value_type>> const capability_interface& set_automaticcolornoncolorpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICDESKEW_::value_type>> const capability_interface& set_automaticdeskew(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICDESKEW_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICDESKEW_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICLENGTHDETECTION_::value_type>> const capability_interface& set_automaticlengthdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICLENGTHDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICLENGTHDETECTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOMATICROTATE_::value_type>> const capability_interface& set_automaticrotate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOMATICROTATE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOMATICROTATE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_AUTOSIZE_::value_type>> const capability_interface& set_autosize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_AUTOSIZE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_AUTOSIZE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODEDETECTIONENABLED_::value_type>> const capability_interface& set_barcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEDETECTIONENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODEMAXRETRIES_::value_type>> const capability_interface& set_barcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXRETRIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODESEARCHMODE_::value_type>> const capability_interface& set_barcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHMODE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODESEARCHPRIORITIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BARCODETIMEOUT_::value_type>> const capability_interface& set_barcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BARCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BARCODETIMEOUT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BITDEPTH_::value_type>> const capability_interface& set_bitdepth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITDEPTH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITDEPTH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BITDEPTHREDUCTION_::value_type>> const capability_interface& set_bitdepthreduction(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITDEPTHREDUCTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITDEPTHREDUCTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BITORDER_::value_type>> const capability_interface& set_bitorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITORDER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITORDER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BITORDERCODES_::value_type>> const capability_interface& set_bitordercodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BITORDERCODES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BITORDERCODES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_BRIGHTNESS_::value_type>> const capability_interface& set_brightness(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_BRIGHTNESS_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_BRIGHTNESS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_CCITTKFACTOR_::value_type>> const capability_interface& set_ccittkfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CCITTKFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CCITTKFACTOR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_COLORMANAGEMENTENABLED_::value_type>> const capability_interface& set_colormanagementenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_COLORMANAGEMENTENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_COLORMANAGEMENTENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_COMPRESSION_::value_type>> const capability_interface& set_compression(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_COMPRESSION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_COMPRESSION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_CONTRAST_::value_type>> const capability_interface& set_contrast(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CONTRAST_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CONTRAST_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_CUSTHALFTONE_::value_type>> const capability_interface& set_custhalftone(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_CUSTHALFTONE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_CUSTHALFTONE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_EXPOSURETIME_::value_type>> const capability_interface& set_exposuretime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_EXPOSURETIME_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_EXPOSURETIME_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_EXTIMAGEINFO_::value_type>> const capability_interface& set_extimageinfo(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_EXTIMAGEINFO_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_EXTIMAGEINFO_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FEEDERTYPE_::value_type>> const capability_interface& set_feedertype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FEEDERTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FEEDERTYPE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FILMTYPE_::value_type>> const capability_interface& set_filmtype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FILMTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FILMTYPE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FILTER_::value_type>> const capability_interface& set_filter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FILTER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FLASHUSED_::value_type>> const capability_interface& set_flashused(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLASHUSED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLASHUSED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FLASHUSED2_::value_type>> const capability_interface& set_flashused2(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLASHUSED2_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLASHUSED2_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FLIPROTATION_::value_type>> const capability_interface& set_fliprotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FLIPROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FLIPROTATION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_FRAMES_::value_type>> const capability_interface& set_frames(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_FRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_FRAMES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_GAMMA_::value_type>> const capability_interface& set_gamma(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_GAMMA_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_GAMMA_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_HALFTONES_::value_type>> const capability_interface& set_halftones(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_HALFTONES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_HALFTONES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_HIGHLIGHT_::value_type>> const capability_interface& set_highlight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_HIGHLIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_HIGHLIGHT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_ICCPROFILE_::value_type>> const capability_interface& set_iccprofile(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ICCPROFILE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ICCPROFILE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_IMAGEDATASET_::value_type>> const capability_interface& set_imagedataset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEDATASET_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEDATASET_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_IMAGEFILEFORMAT_::value_type>> const capability_interface& set_imagefileformat(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEFILEFORMAT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEFILEFORMAT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_IMAGEFILTER_::value_type>> const capability_interface& set_imagefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEFILTER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_IMAGEMERGE_::value_type>> const capability_interface& set_imagemerge(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_IMAGEMERGEHEIGHTTHRESHOLD_::value_type>> const capability_interface& set_imagemergeheightthreshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_JPEGPIXELTYPE_::value_type>> const capability_interface& set_jpegpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGPIXELTYPE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_JPEGQUALITY_::value_type>> const capability_interface& set_jpegquality(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGQUALITY_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGQUALITY_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_JPEGSUBSAMPLING_::value_type>> const capability_interface& set_jpegsubsampling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_JPEGSUBSAMPLING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_JPEGSUBSAMPLING_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_LAMPSTATE_::value_type>> const capability_interface& set_lampstate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LAMPSTATE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LAMPSTATE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_LIGHTPATH_::value_type>> const capability_interface& set_lightpath(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LIGHTPATH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LIGHTPATH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_LIGHTSOURCE_::value_type>> const capability_interface& set_lightsource(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_LIGHTSOURCE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_LIGHTSOURCE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_MAXFRAMES_::value_type>> const capability_interface& set_maxframes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MAXFRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MAXFRAMES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_MINIMUMHEIGHT_::value_type>> const capability_interface& set_minimumheight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MINIMUMHEIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MINIMUMHEIGHT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_MINIMUMWIDTH_::value_type>> const capability_interface& set_minimumwidth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MINIMUMWIDTH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MINIMUMWIDTH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_MIRROR_::value_type>> const capability_interface& set_mirror(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_MIRROR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_MIRROR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_NOISEFILTER_::value_type>> const capability_interface& set_noisefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_NOISEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_NOISEFILTER_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_ORIENTATION_::value_type>> const capability_interface& set_orientation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ORIENTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ORIENTATION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_OVERSCAN_::value_type>> const capability_interface& set_overscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_OVERSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_OVERSCAN_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODEDETECTIONENABLED_::value_type>> const capability_interface& set_patchcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEDETECTIONENABLED_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODEMAXRETRIES_::value_type>> const capability_interface& set_patchcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXRETRIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODESEARCHMODE_::value_type>> const capability_interface& set_patchcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHMODE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODESEARCHPRIORITIES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PATCHCODETIMEOUT_::value_type>> const capability_interface& set_patchcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PATCHCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PATCHCODETIMEOUT_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PIXELFLAVOR_::value_type>> const capability_interface& set_pixelflavor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVOR_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PIXELFLAVORCODES_::value_type>> const capability_interface& set_pixelflavorcodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVORCODES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELFLAVORCODES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PIXELTYPE_::value_type>> const capability_interface& set_pixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PIXELTYPE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_PLANARCHUNKY_::value_type>> const capability_interface& set_planarchunky(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_PLANARCHUNKY_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_PLANARCHUNKY_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_ROTATION_::value_type>> const capability_interface& set_rotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ROTATION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_SHADOW_::value_type>> const capability_interface& set_shadow(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_SHADOW_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_SHADOW_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_SUPPORTEDSIZES_::value_type>> const capability_interface& set_supportedsizes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_SUPPORTEDSIZES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_SUPPORTEDSIZES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_THRESHOLD_::value_type>> const capability_interface& set_threshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_THRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_THRESHOLD_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_TILES_::value_type>> const capability_interface& set_tiles(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_TILES_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_TILES_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_TIMEFILL_::value_type>> const capability_interface& set_timefill(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_TIMEFILL_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_TIMEFILL_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_UNDEFINEDIMAGESIZE_::value_type>> const capability_interface& set_undefinedimagesize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_UNDEFINEDIMAGESIZE_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_UNDEFINEDIMAGESIZE_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_UNITS_::value_type>> const capability_interface& set_units(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_UNITS_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_UNITS_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_XFERMECH_::value_type>> const capability_interface& set_image_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XFERMECH_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_XRESOLUTION_::value_type>> const capability_interface& set_xresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XRESOLUTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_XSCALING_::value_type>> const capability_interface& set_xscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_XSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_XSCALING_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_YRESOLUTION_::value_type>> const capability_interface& set_yresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_YRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_YRESOLUTION_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_YSCALING_::value_type>> const capability_interface& set_yscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_YSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_YSCALING_>({}, reset()); return *this; }
+        template <typename Container = twain_span<ICAP_ZOOMFACTOR_::value_type>> const capability_interface& set_zoomfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container, ICAP_ZOOMFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container, ICAP_ZOOMFACTOR_>({}, reset()); return *this; }
 
         template <typename Container = ACAP_XFERMECH_::value_type> bool is_audio_xfermech_value_supported(const Container& c) const { return is_capvalue_supported<ACAP_XFERMECH_>(static_cast<dtwain_underlying_type<Container>::value_type>(c), 0x1202); }
         template <typename Container = CAP_ALARMS_::value_type> bool is_alarms_value_supported(const Container& c) const { return is_capvalue_supported<CAP_ALARMS_>(static_cast<dtwain_underlying_type<Container>::value_type>(c), 0x1018); }
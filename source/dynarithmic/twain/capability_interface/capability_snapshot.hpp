@@ -0,0 +1,333 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_CAPABILITY_SNAPSHOT_HPP
+#define DTWAIN_CAPABILITY_SNAPSHOT_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <cstdint>
+#include <dtwain.h>
+#include <dynarithmic/twain/types/twain_frame.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Describes one capability query that is part of a capability_snapshot request.
+        struct capability_query
+        {
+            int cap_value;
+            LONG operation;
+            capability_query(int cap = 0, LONG op = DTWAIN_CAPGET) : cap_value(cap), operation(op) {}
+
+            bool operator < (const capability_query& rhs) const
+            { return cap_value < rhs.cap_value || (cap_value == rhs.cap_value && operation < rhs.operation); }
+            bool operator == (const capability_query& rhs) const
+            { return cap_value == rhs.cap_value && operation == rhs.operation; }
+        };
+
+        /// Type-neutral storage for the values of a capability.  Integral and floating point values are held as double,
+        /// strings and frames are held in their own vectors.
+        struct capability_values
+        {
+            std::vector<double> numeric_values;
+            std::vector<std::string> string_values;
+            std::vector<twain_frame<double>> frame_values;
+
+            template <typename Container>
+            static capability_values from(const Container& ct)
+            {
+                capability_values cv;
+                cv.assign(ct);
+                return cv;
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_floating_point<typename Container::value_type>::value ||
+                            std::is_integral<typename Container::value_type>::value, bool>::type = 1>
+            void assign(const Container& ct)
+            {
+                numeric_values.clear();
+                std::transform(ct.begin(), ct.end(), std::back_inserter(numeric_values),
+                               [](typename Container::value_type val) { return static_cast<double>(val); });
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, std::string>::value, bool>::type = 1>
+            void assign(const Container& ct)
+            {
+                string_values.assign(ct.begin(), ct.end());
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, twain_frame<double>>::value, bool>::type = 1>
+            void assign(const Container& ct)
+            {
+                frame_values.assign(ct.begin(), ct.end());
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_floating_point<typename Container::value_type>::value ||
+                            std::is_integral<typename Container::value_type>::value, bool>::type = 1>
+            void copy_to(Container& ct) const
+            {
+                std::transform(numeric_values.begin(), numeric_values.end(), std::inserter(ct, ct.end()),
+                               [](double val) { return static_cast<typename Container::value_type>(val); });
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, std::string>::value, bool>::type = 1>
+            void copy_to(Container& ct) const
+            {
+                std::copy(string_values.begin(), string_values.end(), std::inserter(ct, ct.end()));
+            }
+
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, twain_frame<double>>::value, bool>::type = 1>
+            void copy_to(Container& ct) const
+            {
+                std::copy(frame_values.begin(), frame_values.end(), std::inserter(ct, ct.end()));
+            }
+
+            /// Writes the values as a single line of text, that can be read back with read()
+            void write(std::ostream& strm) const
+            {
+                const auto old_precision = strm.precision(17);
+                strm << numeric_values.size();
+                for (auto d : numeric_values)
+                    strm << " " << d;
+                strm << " " << string_values.size();
+                for (auto& str : string_values)
+                    strm << " " << str.size() << ":" << str;
+                strm << " " << frame_values.size();
+                for (auto& f : frame_values)
+                    strm << " " << f.left << " " << f.top << " " << f.right << " " << f.bottom;
+                strm.precision(old_precision);
+            }
+
+            bool read(std::istream& strm)
+            {
+                size_t count = 0;
+                if (!(strm >> count))
+                    return false;
+                numeric_values.resize(count);
+                for (auto& d : numeric_values)
+                {
+                    if (!(strm >> d))
+                        return false;
+                }
+                if (!(strm >> count))
+                    return false;
+                string_values.resize(count);
+                for (auto& str : string_values)
+                {
+                    size_t len = 0;
+                    char sep = 0;
+                    if (!(strm >> len) || !strm.get(sep) || sep != ':')
+                        return false;
+                    str.resize(len);
+                    if (len > 0 && !strm.read(&str[0], static_cast<std::streamsize>(len)))
+                        return false;
+                }
+                if (!(strm >> count))
+                    return false;
+                frame_values.resize(count);
+                for (auto& f : frame_values)
+                {
+                    if (!(strm >> f.left >> f.top >> f.right >> f.bottom))
+                        return false;
+                }
+                return true;
+            }
+
+            bool operator == (const capability_values& rhs) const
+            {
+                return numeric_values == rhs.numeric_values && string_values == rhs.string_values &&
+                       frame_values == rhs.frame_values;
+            }
+            bool operator != (const capability_values& rhs) const { return !(*this == rhs); }
+        };
+
+        /// Describes one capability set operation, as recorded by capability_interface::begin_recording()
+        struct capability_setting
+        {
+            int cap_value = 0;
+            LONG operation = DTWAIN_CAPSET;
+            capability_values values;
+        };
+
+        /// An incremental 64-bit FNV-1a hash of capability values
+        struct capability_hasher
+        {
+            uint64_t value = 14695981039346656037ULL;
+
+            void add_bytes(const void* p, size_t n)
+            {
+                auto pBytes = static_cast<const unsigned char*>(p);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    value ^= pBytes[i];
+                    value *= 1099511628211ULL;
+                }
+            }
+
+            // numeric values are hashed as double, matching how capability_values stores them
+            template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = 1>
+            void add_value(T val)
+            {
+                const double d = static_cast<double>(val);
+                add_bytes(&d, sizeof d);
+            }
+
+            void add_value(const std::string& str) { add_bytes(str.c_str(), str.size() + 1); }
+
+            void add_value(const twain_frame<double>& f)
+            {
+                const double coords[] = { f.left, f.top, f.right, f.bottom };
+                add_bytes(coords, sizeof coords);
+            }
+        };
+
+        /// Computes a 64-bit FNV-1a fingerprint of a sequence of capability settings.  Two sequences that set the same
+        /// capabilities to the same values in the same order produce the same fingerprint.
+        inline uint64_t capability_fingerprint(const std::vector<capability_setting>& settings)
+        {
+            capability_hasher hasher;
+            for (auto& s : settings)
+            {
+                hasher.add_bytes(&s.cap_value, sizeof s.cap_value);
+                hasher.add_bytes(&s.operation, sizeof s.operation);
+                for (auto d : s.values.numeric_values)
+                    hasher.add_value(d);
+                for (auto& str : s.values.string_values)
+                    hasher.add_value(str);
+                for (auto& f : s.values.frame_values)
+                    hasher.add_value(f);
+            }
+            return hasher.value;
+        }
+
+        /// Computes a 64-bit FNV-1a hash of a single set operation, without copying the values
+        template <typename Container>
+        uint64_t capability_values_hash(LONG operation, const Container& ct)
+        {
+            capability_hasher hasher;
+            hasher.add_bytes(&operation, sizeof operation);
+            for (auto& val : ct)
+                hasher.add_value(val);
+            return hasher.value;
+        }
+
+        /// An immutable set of capability values retrieved in one batch by capability_interface::get_snapshot().
+        ///
+        /// The snapshot is ordered by capability and operation, and each (capability, operation) pair is queried once,
+        /// regardless of how many times it appears in the request.  Values are stored in a type-neutral form, and are
+        /// converted to the requested container type on retrieval.
+        /// @see capability_interface::get_snapshot()
+        class capability_snapshot
+        {
+            public:
+                struct entry : capability_values
+                {
+                    bool return_value = false;
+                    int32_t error_code = DTWAIN_ERR_CAP_NO_SUPPORT;
+                    bool is_range = false;
+                    bool from_cache = false;
+                    bool from_device = false;   ///< **true** if the device was called to retrieve this entry
+                    LONG container_type = 0;    ///< The DTWAIN_CONTxxx container of the values, or 0 if it is not known
+                };
+                typedef std::map<capability_query, entry> entry_map;
+
+                capability_snapshot() = default;
+                capability_snapshot(entry_map&& entries, size_t num_requested, size_t num_driver_calls, size_t num_cache_hits) :
+                                    m_entries(std::move(entries)), m_nRequested(num_requested),
+                                    m_nDriverCalls(num_driver_calls), m_nCacheHits(num_cache_hits) {}
+
+                /// Returns the entry for the capability and operation, or nullptr if the pair was not part of the request
+                const entry* find(int cap_value, LONG operation = DTWAIN_CAPGET) const
+                {
+                    auto iter = m_entries.find({ cap_value, operation });
+                    if (iter == m_entries.end())
+                        return nullptr;
+                    return &iter->second;
+                }
+
+                bool contains(int cap_value, LONG operation = DTWAIN_CAPGET) const { return find(cap_value, operation) != nullptr; }
+
+                /// Returns **true** if the capability was retrieved successfully
+                bool succeeded(int cap_value, LONG operation = DTWAIN_CAPGET) const
+                {
+                    auto pEntry = find(cap_value, operation);
+                    return pEntry && pEntry->return_value;
+                }
+
+                bool is_range(int cap_value, LONG operation = DTWAIN_CAPGET) const
+                {
+                    auto pEntry = find(cap_value, operation);
+                    return pEntry && pEntry->is_range;
+                }
+
+                /// Returns the values of the capability converted to **Container**.  An empty container is returned if the
+                /// capability was not retrieved successfully, or was not part of the request.
+                template <typename Container>
+                Container get(int cap_value, LONG operation = DTWAIN_CAPGET) const
+                {
+                    Container ct {};
+                    auto pEntry = find(cap_value, operation);
+                    if (pEntry && pEntry->return_value)
+                        pEntry->copy_to(ct);
+                    return ct;
+                }
+
+                /// Returns the values of capability type **T** (for example, ICAP_PIXELTYPE_) converted to **Container**
+                template <typename T, typename Container = std::vector<typename T::value_type>>
+                Container get_values(LONG operation = DTWAIN_CAPGET) const
+                {
+                    return get<Container>(T::cap_value, operation);
+                }
+
+                const entry_map& get_entries() const noexcept { return m_entries; }
+
+                /// Number of queries passed to get_snapshot(), before removing duplicates
+                size_t get_request_count() const noexcept { return m_nRequested; }
+
+                /// Number of queries that required a call to the device
+                size_t get_driver_call_count() const noexcept { return m_nDriverCalls; }
+
+                /// Number of queries that were satisfied by the capability cache
+                size_t get_cache_hit_count() const noexcept { return m_nCacheHits; }
+                size_t size() const noexcept { return m_entries.size(); }
+
+            private:
+                entry_map m_entries;
+                size_t m_nRequested = 0;
+                size_t m_nDriverCalls = 0;
+                size_t m_nCacheHits = 0;
+        };
+    }
+}
+#endif
@@ -0,0 +1,82 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_CAPABILITY_STATE_HPP
+#define DTWAIN_CAPABILITY_STATE_HPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <dynarithmic/twain/capability_interface/capability_snapshot.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Publishes immutable capability_snapshot objects from the TWAIN thread to other threads.
+        ///
+        /// The capability_interface may only be used by the thread that makes the TWAIN calls.  Other threads, such as a
+        /// thread that monitors the resolution or the feeder status, read the most recently published snapshot instead.
+        /// A published snapshot is never modified: the TWAIN thread publishes a new snapshot, and readers that still hold
+        /// the previous one keep a valid copy until they release it.
+        /// @note The snapshot pointer is exchanged with the std::shared_ptr atomic functions.  Standard libraries implement
+        /// these with a small internal lock, so publish() and get() are thread safe, but are not lock-free.  The lock is
+        /// only held while the pointer is copied, never while a snapshot is built or read.
+        class capability_state_publisher
+        {
+            std::shared_ptr<const capability_snapshot> m_current;
+            std::atomic<uint64_t> m_nVersion;
+
+            public:
+                capability_state_publisher() : m_current(std::make_shared<const capability_snapshot>()), m_nVersion(0) {}
+                capability_state_publisher(const capability_state_publisher&) = delete;
+                capability_state_publisher& operator=(const capability_state_publisher&) = delete;
+
+                /// Replaces the published snapshot.  Only called from the TWAIN thread.
+                void publish(capability_snapshot&& snapshot)
+                {
+                    std::shared_ptr<const capability_snapshot> pNew = std::make_shared<const capability_snapshot>(std::move(snapshot));
+                    std::atomic_store_explicit(&m_current, std::move(pNew), std::memory_order_release);
+                    m_nVersion.fetch_add(1, std::memory_order_release);
+                }
+
+                /// Returns the most recently published snapshot.  Can be called from any thread.
+                /// @note The returned snapshot remains valid for as long as it is held, even if a newer snapshot is published.
+                std::shared_ptr<const capability_snapshot> get() const
+                {
+                    return std::atomic_load_explicit(&m_current, std::memory_order_acquire);
+                }
+
+                /// Returns the number of snapshots published.  A reader can poll this value to test if get() would return a
+                /// newer snapshot, without taking a reference to it.
+                uint64_t get_version() const noexcept { return m_nVersion.load(std::memory_order_acquire); }
+        };
+
+        /// The capabilities that a twain_source publishes by default, using get_current()
+        inline std::vector<capability_query> get_default_monitored_caps()
+        {
+            return { { ICAP_XRESOLUTION, DTWAIN_CAPGETCURRENT }, { ICAP_YRESOLUTION, DTWAIN_CAPGETCURRENT },
+                     { ICAP_PIXELTYPE, DTWAIN_CAPGETCURRENT }, { CAP_DUPLEXENABLED, DTWAIN_CAPGETCURRENT },
+                     { CAP_FEEDERENABLED, DTWAIN_CAPGETCURRENT }, { CAP_FEEDERLOADED, DTWAIN_CAPGETCURRENT } };
+        }
+    }
+}
+#endif
@@ -163,144 +163,144 @@ template <typename Container=std::vector<ICAP_YRESOLUTION_::value_type>> Contain
 template <typename Container=std::vector<ICAP_YSCALING_::value_type>> Container get_yscaling(const getcap_operation_info& gcType = getcap_operation_info()) const { Container ct; m_return_type = get_caps_impl<Container,ICAP_YSCALING_>(ct, gcType); return ct; }
 template <typename Container=std::vector<ICAP_ZOOMFACTOR_::value_type>> Container get_zoomfactor(const getcap_operation_info& gcType = getcap_operation_info()) const { Container ct; m_return_type = get_caps_impl<Container,ICAP_ZOOMFACTOR_>(ct, gcType); return ct; }
 
-template <typename Container=std::vector<ACAP_XFERMECH_::value_type>> const capability_interface& set_audio_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ACAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container,ACAP_XFERMECH_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_ALARMS_::value_type>> const capability_interface& set_alarms(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ALARMS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ALARMS_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_ALARMVOLUME_::value_type>> const capability_interface& set_alarmvolume(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ALARMVOLUME_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ALARMVOLUME_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_AUTHOR_::value_type>> const capability_interface& set_author(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTHOR_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTHOR_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_AUTOFEED_::value_type>> const capability_interface& set_autofeed(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOFEED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOFEED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_AUTOMATICCAPTURE_::value_type>> const capability_interface& set_automaticcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOMATICCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOMATICCAPTURE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_AUTOMATICSENSEMEDIUM_::value_type>> const capability_interface& set_automaticsensemedium(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOMATICSENSEMEDIUM_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOMATICSENSEMEDIUM_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_AUTOSCAN_::value_type>> const capability_interface& set_autoscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOSCAN_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_CAMERAENABLED_::value_type>> const capability_interface& set_cameraenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERAENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERAENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_CAMERAORDER_::value_type>> const capability_interface& set_cameraorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERAORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERAORDER_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_CAMERASIDE_::value_type>> const capability_interface& set_cameraside(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERASIDE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERASIDE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_CAPTION_::value_type>> const capability_interface& set_caption(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAPTION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAPTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_CLEARPAGE_::value_type>> const capability_interface& set_clearpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CLEARPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CLEARPAGE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DEVICEEVENT_::value_type>> const capability_interface& set_deviceevent(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DEVICEEVENT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DEVICEEVENT_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DEVICETIMEDATE_::value_type>> const capability_interface& set_devicetimedate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DEVICETIMEDATE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DEVICETIMEDATE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DOUBLEFEEDDETECTION_::value_type>> const capability_interface& set_doublefeeddetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DOUBLEFEEDDETECTIONLENGTH_::value_type>> const capability_interface& set_doublefeeddetectionlength(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONLENGTH_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONLENGTH_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DOUBLEFEEDDETECTIONRESPONSE_::value_type>> const capability_interface& set_doublefeeddetectionresponse(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONRESPONSE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONRESPONSE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DOUBLEFEEDDETECTIONSENSITIVITY_::value_type>> const capability_interface& set_doublefeeddetectionsensitivity(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_DUPLEXENABLED_::value_type>> const capability_interface& set_duplexenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DUPLEXENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DUPLEXENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_ENDORSER_::value_type>> const capability_interface& set_endorser(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ENDORSER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ENDORSER_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_EXTENDEDCAPS_::value_type>> const capability_interface& set_extendedcaps(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_EXTENDEDCAPS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_EXTENDEDCAPS_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDERALIGNMENT_::value_type>> const capability_interface& set_feederalignment(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERALIGNMENT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERALIGNMENT_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDERENABLED_::value_type>> const capability_interface& set_feederenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDERORDER_::value_type>> const capability_interface& set_feederorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERORDER_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDERPOCKET_::value_type>> const capability_interface& set_feederpocket(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERPOCKET_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERPOCKET_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDERPREP_::value_type>> const capability_interface& set_feederprep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERPREP_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERPREP_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_FEEDPAGE_::value_type>> const capability_interface& set_feedpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDPAGE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_INDICATORS_::value_type>> const capability_interface& set_indicators(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_INDICATORS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_INDICATORS_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_INDICATORSMODE_::value_type>> const capability_interface& set_indicatorsmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_INDICATORSMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_INDICATORSMODE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_JOBCONTROL_::value_type>> const capability_interface& set_jobcontrol(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_JOBCONTROL_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_JOBCONTROL_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_LANGUAGE_::value_type>> const capability_interface& set_language(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_LANGUAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_LANGUAGE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_MAXBATCHBUFFERS_::value_type>> const capability_interface& set_maxbatchbuffers(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_MAXBATCHBUFFERS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_MAXBATCHBUFFERS_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_MICRENABLED_::value_type>> const capability_interface& set_micrenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_MICRENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_MICRENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PAPERHANDLING_::value_type>> const capability_interface& set_paperhandling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PAPERHANDLING_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PAPERHANDLING_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_POWERSAVETIME_::value_type>> const capability_interface& set_powersavetime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_POWERSAVETIME_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_POWERSAVETIME_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTER_::value_type>> const capability_interface& set_printer(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTER_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERCHARROTATION_::value_type>> const capability_interface& set_printercharrotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERCHARROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERCHARROTATION_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERENABLED_::value_type>> const capability_interface& set_printerenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERFONTSTYLE_::value_type>> const capability_interface& set_printerfontstyle(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERFONTSTYLE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERFONTSTYLE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEX_::value_type>> const capability_interface& set_printerindex(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEX_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEX_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEXLEADCHAR_::value_type>> const capability_interface& set_printerindexleadchar(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXLEADCHAR_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXLEADCHAR_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEXMAXVALUE_::value_type>> const capability_interface& set_printerindexmaxvalue(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXMAXVALUE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXMAXVALUE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEXNUMDIGITS_::value_type>> const capability_interface& set_printerindexnumdigits(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXNUMDIGITS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXNUMDIGITS_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEXSTEP_::value_type>> const capability_interface& set_printerindexstep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXSTEP_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXSTEP_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERINDEXTRIGGER_::value_type>> const capability_interface& set_printerindextrigger(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXTRIGGER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXTRIGGER_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERMODE_::value_type>> const capability_interface& set_printermode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERMODE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERSTRING_::value_type>> const capability_interface& set_printerstring(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERSTRING_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERSTRING_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERSUFFIX_::value_type>> const capability_interface& set_printersuffix(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERSUFFIX_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERSUFFIX_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_PRINTERVERTICALOFFSET_::value_type>> const capability_interface& set_printerverticaloffset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERVERTICALOFFSET_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERVERTICALOFFSET_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_REWINDPAGE_::value_type>> const capability_interface& set_rewindpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_REWINDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_REWINDPAGE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_SEGMENTED_::value_type>> const capability_interface& set_segmented(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SEGMENTED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SEGMENTED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_SHEETCOUNT_::value_type>> const capability_interface& set_sheetcount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SHEETCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SHEETCOUNT_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_SUPPORTEDCAPSSEGMENTUNIQUE_::value_type>> const capability_interface& set_supportedcapssegmentunique(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_THUMBNAILSENABLED_::value_type>> const capability_interface& set_thumbnailsenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_THUMBNAILSENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_THUMBNAILSENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_TIMEBEFOREFIRSTCAPTURE_::value_type>> const capability_interface& set_timebeforefirstcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_TIMEBEFOREFIRSTCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_TIMEBEFOREFIRSTCAPTURE_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_TIMEBETWEENCAPTURES_::value_type>> const capability_interface& set_timebetweencaptures(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_TIMEBETWEENCAPTURES_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_TIMEBETWEENCAPTURES_>({}, reset()); return *this;}
-template <typename Container=std::vector<CAP_XFERCOUNT_::value_type>> const capability_interface& set_xfercount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_XFERCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_XFERCOUNT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOBRIGHT_::value_type>> const capability_interface& set_autobright(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOBRIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOBRIGHT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTODISCARDBLANKPAGES_::value_type>> const capability_interface& set_autodiscardblankpages(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTODISCARDBLANKPAGES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTODISCARDBLANKPAGES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICBORDERDETECTION_::value_type>> const capability_interface& set_automaticborderdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICBORDERDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICBORDERDETECTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICCOLORENABLED_::value_type>> const capability_interface& set_automaticcolorenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_::value_type>> const capability_interface& set_automaticcolornoncolorpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICDESKEW_::value_type>> const capability_interface& set_automaticdeskew(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICDESKEW_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICDESKEW_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICLENGTHDETECTION_::value_type>> const capability_interface& set_automaticlengthdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICLENGTHDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICLENGTHDETECTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOMATICROTATE_::value_type>> const capability_interface& set_automaticrotate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICROTATE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICROTATE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_AUTOSIZE_::value_type>> const capability_interface& set_autosize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOSIZE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOSIZE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODEDETECTIONENABLED_::value_type>> const capability_interface& set_barcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEDETECTIONENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODEMAXRETRIES_::value_type>> const capability_interface& set_barcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXRETRIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODESEARCHMODE_::value_type>> const capability_interface& set_barcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHMODE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHPRIORITIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BARCODETIMEOUT_::value_type>> const capability_interface& set_barcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODETIMEOUT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BITDEPTH_::value_type>> const capability_interface& set_bitdepth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITDEPTH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITDEPTH_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BITDEPTHREDUCTION_::value_type>> const capability_interface& set_bitdepthreduction(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITDEPTHREDUCTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITDEPTHREDUCTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BITORDER_::value_type>> const capability_interface& set_bitorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITORDER_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BITORDERCODES_::value_type>> const capability_interface& set_bitordercodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITORDERCODES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITORDERCODES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_BRIGHTNESS_::value_type>> const capability_interface& set_brightness(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BRIGHTNESS_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BRIGHTNESS_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_CCITTKFACTOR_::value_type>> const capability_interface& set_ccittkfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CCITTKFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CCITTKFACTOR_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_COLORMANAGEMENTENABLED_::value_type>> const capability_interface& set_colormanagementenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_COLORMANAGEMENTENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_COLORMANAGEMENTENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_COMPRESSION_::value_type>> const capability_interface& set_compression(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_COMPRESSION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_COMPRESSION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_CONTRAST_::value_type>> const capability_interface& set_contrast(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CONTRAST_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CONTRAST_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_CUSTHALFTONE_::value_type>> const capability_interface& set_custhalftone(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CUSTHALFTONE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CUSTHALFTONE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_EXPOSURETIME_::value_type>> const capability_interface& set_exposuretime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_EXPOSURETIME_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_EXPOSURETIME_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_EXTIMAGEINFO_::value_type>> const capability_interface& set_extimageinfo(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_EXTIMAGEINFO_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_EXTIMAGEINFO_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FEEDERTYPE_::value_type>> const capability_interface& set_feedertype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FEEDERTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FEEDERTYPE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FILMTYPE_::value_type>> const capability_interface& set_filmtype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FILMTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FILMTYPE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FILTER_::value_type>> const capability_interface& set_filter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FILTER_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FLASHUSED_::value_type>> const capability_interface& set_flashused(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLASHUSED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLASHUSED_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FLASHUSED2_::value_type>> const capability_interface& set_flashused2(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLASHUSED2_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLASHUSED2_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FLIPROTATION_::value_type>> const capability_interface& set_fliprotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLIPROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLIPROTATION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_FRAMES_::value_type>> const capability_interface& set_frames(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FRAMES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_GAMMA_::value_type>> const capability_interface& set_gamma(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_GAMMA_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_GAMMA_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_HALFTONES_::value_type>> const capability_interface& set_halftones(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_HALFTONES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_HALFTONES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_HIGHLIGHT_::value_type>> const capability_interface& set_highlight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_HIGHLIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_HIGHLIGHT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_ICCPROFILE_::value_type>> const capability_interface& set_iccprofile(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ICCPROFILE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ICCPROFILE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_IMAGEDATASET_::value_type>> const capability_interface& set_imagedataset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEDATASET_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEDATASET_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_IMAGEFILEFORMAT_::value_type>> const capability_interface& set_imagefileformat(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEFILEFORMAT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEFILEFORMAT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_IMAGEFILTER_::value_type>> const capability_interface& set_imagefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEFILTER_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_IMAGEMERGE_::value_type>> const capability_interface& set_imagemerge(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_IMAGEMERGEHEIGHTTHRESHOLD_::value_type>> const capability_interface& set_imagemergeheightthreshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_JPEGPIXELTYPE_::value_type>> const capability_interface& set_jpegpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGPIXELTYPE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_JPEGQUALITY_::value_type>> const capability_interface& set_jpegquality(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGQUALITY_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGQUALITY_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_JPEGSUBSAMPLING_::value_type>> const capability_interface& set_jpegsubsampling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGSUBSAMPLING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGSUBSAMPLING_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_LAMPSTATE_::value_type>> const capability_interface& set_lampstate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LAMPSTATE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LAMPSTATE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_LIGHTPATH_::value_type>> const capability_interface& set_lightpath(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LIGHTPATH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LIGHTPATH_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_LIGHTSOURCE_::value_type>> const capability_interface& set_lightsource(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LIGHTSOURCE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LIGHTSOURCE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_MAXFRAMES_::value_type>> const capability_interface& set_maxframes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MAXFRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MAXFRAMES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_MINIMUMHEIGHT_::value_type>> const capability_interface& set_minimumheight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MINIMUMHEIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MINIMUMHEIGHT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_MINIMUMWIDTH_::value_type>> const capability_interface& set_minimumwidth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MINIMUMWIDTH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MINIMUMWIDTH_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_MIRROR_::value_type>> const capability_interface& set_mirror(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MIRROR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MIRROR_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_NOISEFILTER_::value_type>> const capability_interface& set_noisefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_NOISEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_NOISEFILTER_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_ORIENTATION_::value_type>> const capability_interface& set_orientation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ORIENTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ORIENTATION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_OVERSCAN_::value_type>> const capability_interface& set_overscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_OVERSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_OVERSCAN_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODEDETECTIONENABLED_::value_type>> const capability_interface& set_patchcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEDETECTIONENABLED_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODEMAXRETRIES_::value_type>> const capability_interface& set_patchcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXRETRIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODESEARCHMODE_::value_type>> const capability_interface& set_patchcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHMODE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHPRIORITIES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PATCHCODETIMEOUT_::value_type>> const capability_interface& set_patchcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODETIMEOUT_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PIXELFLAVOR_::value_type>> const capability_interface& set_pixelflavor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVOR_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PIXELFLAVORCODES_::value_type>> const capability_interface& set_pixelflavorcodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVORCODES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVORCODES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PIXELTYPE_::value_type>> const capability_interface& set_pixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELTYPE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_PLANARCHUNKY_::value_type>> const capability_interface& set_planarchunky(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PLANARCHUNKY_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PLANARCHUNKY_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_ROTATION_::value_type>> const capability_interface& set_rotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ROTATION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_SHADOW_::value_type>> const capability_interface& set_shadow(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_SHADOW_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_SHADOW_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_SUPPORTEDSIZES_::value_type>> const capability_interface& set_supportedsizes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_SUPPORTEDSIZES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_SUPPORTEDSIZES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_THRESHOLD_::value_type>> const capability_interface& set_threshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_THRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_THRESHOLD_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_TILES_::value_type>> const capability_interface& set_tiles(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_TILES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_TILES_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_TIMEFILL_::value_type>> const capability_interface& set_timefill(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_TIMEFILL_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_TIMEFILL_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_UNDEFINEDIMAGESIZE_::value_type>> const capability_interface& set_undefinedimagesize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_UNDEFINEDIMAGESIZE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_UNDEFINEDIMAGESIZE_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_UNITS_::value_type>> const capability_interface& set_units(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_UNITS_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_UNITS_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_XFERMECH_::value_type>> const capability_interface& set_image_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XFERMECH_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_XRESOLUTION_::value_type>> const capability_interface& set_xresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XRESOLUTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_XSCALING_::value_type>> const capability_interface& set_xscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XSCALING_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_YRESOLUTION_::value_type>> const capability_interface& set_yresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_YRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_YRESOLUTION_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_YSCALING_::value_type>> const capability_interface& set_yscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_YSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_YSCALING_>({}, reset()); return *this;}
-template <typename Container=std::vector<ICAP_ZOOMFACTOR_::value_type>> const capability_interface& set_zoomfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ZOOMFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ZOOMFACTOR_>({}, reset()); return *this;}
+template <typename Container=twain_span<ACAP_XFERMECH_::value_type>> const capability_interface& set_audio_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ACAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container,ACAP_XFERMECH_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_ALARMS_::value_type>> const capability_interface& set_alarms(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ALARMS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ALARMS_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_ALARMVOLUME_::value_type>> const capability_interface& set_alarmvolume(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ALARMVOLUME_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ALARMVOLUME_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_AUTHOR_::value_type>> const capability_interface& set_author(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTHOR_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTHOR_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_AUTOFEED_::value_type>> const capability_interface& set_autofeed(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOFEED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOFEED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_AUTOMATICCAPTURE_::value_type>> const capability_interface& set_automaticcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOMATICCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOMATICCAPTURE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_AUTOMATICSENSEMEDIUM_::value_type>> const capability_interface& set_automaticsensemedium(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOMATICSENSEMEDIUM_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOMATICSENSEMEDIUM_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_AUTOSCAN_::value_type>> const capability_interface& set_autoscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_AUTOSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_AUTOSCAN_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_CAMERAENABLED_::value_type>> const capability_interface& set_cameraenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERAENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERAENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_CAMERAORDER_::value_type>> const capability_interface& set_cameraorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERAORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERAORDER_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_CAMERASIDE_::value_type>> const capability_interface& set_cameraside(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAMERASIDE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAMERASIDE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_CAPTION_::value_type>> const capability_interface& set_caption(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CAPTION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CAPTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_CLEARPAGE_::value_type>> const capability_interface& set_clearpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_CLEARPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_CLEARPAGE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DEVICEEVENT_::value_type>> const capability_interface& set_deviceevent(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DEVICEEVENT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DEVICEEVENT_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DEVICETIMEDATE_::value_type>> const capability_interface& set_devicetimedate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DEVICETIMEDATE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DEVICETIMEDATE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DOUBLEFEEDDETECTION_::value_type>> const capability_interface& set_doublefeeddetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DOUBLEFEEDDETECTIONLENGTH_::value_type>> const capability_interface& set_doublefeeddetectionlength(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONLENGTH_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONLENGTH_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DOUBLEFEEDDETECTIONRESPONSE_::value_type>> const capability_interface& set_doublefeeddetectionresponse(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONRESPONSE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONRESPONSE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DOUBLEFEEDDETECTIONSENSITIVITY_::value_type>> const capability_interface& set_doublefeeddetectionsensitivity(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DOUBLEFEEDDETECTIONSENSITIVITY_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_DUPLEXENABLED_::value_type>> const capability_interface& set_duplexenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_DUPLEXENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_DUPLEXENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_ENDORSER_::value_type>> const capability_interface& set_endorser(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_ENDORSER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_ENDORSER_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_EXTENDEDCAPS_::value_type>> const capability_interface& set_extendedcaps(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_EXTENDEDCAPS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_EXTENDEDCAPS_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDERALIGNMENT_::value_type>> const capability_interface& set_feederalignment(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERALIGNMENT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERALIGNMENT_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDERENABLED_::value_type>> const capability_interface& set_feederenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDERORDER_::value_type>> const capability_interface& set_feederorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERORDER_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDERPOCKET_::value_type>> const capability_interface& set_feederpocket(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERPOCKET_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERPOCKET_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDERPREP_::value_type>> const capability_interface& set_feederprep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDERPREP_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDERPREP_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_FEEDPAGE_::value_type>> const capability_interface& set_feedpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_FEEDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_FEEDPAGE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_INDICATORS_::value_type>> const capability_interface& set_indicators(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_INDICATORS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_INDICATORS_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_INDICATORSMODE_::value_type>> const capability_interface& set_indicatorsmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_INDICATORSMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_INDICATORSMODE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_JOBCONTROL_::value_type>> const capability_interface& set_jobcontrol(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_JOBCONTROL_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_JOBCONTROL_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_LANGUAGE_::value_type>> const capability_interface& set_language(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_LANGUAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_LANGUAGE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_MAXBATCHBUFFERS_::value_type>> const capability_interface& set_maxbatchbuffers(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_MAXBATCHBUFFERS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_MAXBATCHBUFFERS_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_MICRENABLED_::value_type>> const capability_interface& set_micrenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_MICRENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_MICRENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PAPERHANDLING_::value_type>> const capability_interface& set_paperhandling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PAPERHANDLING_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PAPERHANDLING_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_POWERSAVETIME_::value_type>> const capability_interface& set_powersavetime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_POWERSAVETIME_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_POWERSAVETIME_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTER_::value_type>> const capability_interface& set_printer(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTER_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERCHARROTATION_::value_type>> const capability_interface& set_printercharrotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERCHARROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERCHARROTATION_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERENABLED_::value_type>> const capability_interface& set_printerenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERFONTSTYLE_::value_type>> const capability_interface& set_printerfontstyle(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERFONTSTYLE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERFONTSTYLE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEX_::value_type>> const capability_interface& set_printerindex(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEX_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEX_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEXLEADCHAR_::value_type>> const capability_interface& set_printerindexleadchar(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXLEADCHAR_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXLEADCHAR_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEXMAXVALUE_::value_type>> const capability_interface& set_printerindexmaxvalue(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXMAXVALUE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXMAXVALUE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEXNUMDIGITS_::value_type>> const capability_interface& set_printerindexnumdigits(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXNUMDIGITS_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXNUMDIGITS_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEXSTEP_::value_type>> const capability_interface& set_printerindexstep(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXSTEP_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXSTEP_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERINDEXTRIGGER_::value_type>> const capability_interface& set_printerindextrigger(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXTRIGGER_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERINDEXTRIGGER_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERMODE_::value_type>> const capability_interface& set_printermode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERMODE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERSTRING_::value_type>> const capability_interface& set_printerstring(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERSTRING_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERSTRING_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERSUFFIX_::value_type>> const capability_interface& set_printersuffix(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERSUFFIX_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERSUFFIX_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_PRINTERVERTICALOFFSET_::value_type>> const capability_interface& set_printerverticaloffset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_PRINTERVERTICALOFFSET_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_PRINTERVERTICALOFFSET_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_REWINDPAGE_::value_type>> const capability_interface& set_rewindpage(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_REWINDPAGE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_REWINDPAGE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_SEGMENTED_::value_type>> const capability_interface& set_segmented(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SEGMENTED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SEGMENTED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_SHEETCOUNT_::value_type>> const capability_interface& set_sheetcount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SHEETCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SHEETCOUNT_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_SUPPORTEDCAPSSEGMENTUNIQUE_::value_type>> const capability_interface& set_supportedcapssegmentunique(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_SUPPORTEDCAPSSEGMENTUNIQUE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_THUMBNAILSENABLED_::value_type>> const capability_interface& set_thumbnailsenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_THUMBNAILSENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_THUMBNAILSENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_TIMEBEFOREFIRSTCAPTURE_::value_type>> const capability_interface& set_timebeforefirstcapture(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_TIMEBEFOREFIRSTCAPTURE_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_TIMEBEFOREFIRSTCAPTURE_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_TIMEBETWEENCAPTURES_::value_type>> const capability_interface& set_timebetweencaptures(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_TIMEBETWEENCAPTURES_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_TIMEBETWEENCAPTURES_>({}, reset()); return *this;}
+template <typename Container=twain_span<CAP_XFERCOUNT_::value_type>> const capability_interface& set_xfercount(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,CAP_XFERCOUNT_>(ct, scType); else m_return_type = set_caps_impl<Container,CAP_XFERCOUNT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOBRIGHT_::value_type>> const capability_interface& set_autobright(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOBRIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOBRIGHT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTODISCARDBLANKPAGES_::value_type>> const capability_interface& set_autodiscardblankpages(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTODISCARDBLANKPAGES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTODISCARDBLANKPAGES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICBORDERDETECTION_::value_type>> const capability_interface& set_automaticborderdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICBORDERDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICBORDERDETECTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICCOLORENABLED_::value_type>> const capability_interface& set_automaticcolorenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_::value_type>> const capability_interface& set_automaticcolornoncolorpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICCOLORNONCOLORPIXELTYPE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICDESKEW_::value_type>> const capability_interface& set_automaticdeskew(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICDESKEW_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICDESKEW_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICLENGTHDETECTION_::value_type>> const capability_interface& set_automaticlengthdetection(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICLENGTHDETECTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICLENGTHDETECTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOMATICROTATE_::value_type>> const capability_interface& set_automaticrotate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOMATICROTATE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOMATICROTATE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_AUTOSIZE_::value_type>> const capability_interface& set_autosize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_AUTOSIZE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_AUTOSIZE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODEDETECTIONENABLED_::value_type>> const capability_interface& set_barcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEDETECTIONENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODEMAXRETRIES_::value_type>> const capability_interface& set_barcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXRETRIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODESEARCHMODE_::value_type>> const capability_interface& set_barcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHMODE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_barcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODESEARCHPRIORITIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BARCODETIMEOUT_::value_type>> const capability_interface& set_barcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BARCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BARCODETIMEOUT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BITDEPTH_::value_type>> const capability_interface& set_bitdepth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITDEPTH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITDEPTH_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BITDEPTHREDUCTION_::value_type>> const capability_interface& set_bitdepthreduction(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITDEPTHREDUCTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITDEPTHREDUCTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BITORDER_::value_type>> const capability_interface& set_bitorder(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITORDER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITORDER_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BITORDERCODES_::value_type>> const capability_interface& set_bitordercodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BITORDERCODES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BITORDERCODES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_BRIGHTNESS_::value_type>> const capability_interface& set_brightness(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_BRIGHTNESS_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_BRIGHTNESS_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_CCITTKFACTOR_::value_type>> const capability_interface& set_ccittkfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CCITTKFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CCITTKFACTOR_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_COLORMANAGEMENTENABLED_::value_type>> const capability_interface& set_colormanagementenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_COLORMANAGEMENTENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_COLORMANAGEMENTENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_COMPRESSION_::value_type>> const capability_interface& set_compression(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_COMPRESSION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_COMPRESSION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_CONTRAST_::value_type>> const capability_interface& set_contrast(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CONTRAST_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CONTRAST_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_CUSTHALFTONE_::value_type>> const capability_interface& set_custhalftone(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_CUSTHALFTONE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_CUSTHALFTONE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_EXPOSURETIME_::value_type>> const capability_interface& set_exposuretime(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_EXPOSURETIME_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_EXPOSURETIME_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_EXTIMAGEINFO_::value_type>> const capability_interface& set_extimageinfo(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_EXTIMAGEINFO_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_EXTIMAGEINFO_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FEEDERTYPE_::value_type>> const capability_interface& set_feedertype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FEEDERTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FEEDERTYPE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FILMTYPE_::value_type>> const capability_interface& set_filmtype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FILMTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FILMTYPE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FILTER_::value_type>> const capability_interface& set_filter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FILTER_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FLASHUSED_::value_type>> const capability_interface& set_flashused(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLASHUSED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLASHUSED_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FLASHUSED2_::value_type>> const capability_interface& set_flashused2(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLASHUSED2_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLASHUSED2_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FLIPROTATION_::value_type>> const capability_interface& set_fliprotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FLIPROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FLIPROTATION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_FRAMES_::value_type>> const capability_interface& set_frames(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_FRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_FRAMES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_GAMMA_::value_type>> const capability_interface& set_gamma(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_GAMMA_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_GAMMA_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_HALFTONES_::value_type>> const capability_interface& set_halftones(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_HALFTONES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_HALFTONES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_HIGHLIGHT_::value_type>> const capability_interface& set_highlight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_HIGHLIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_HIGHLIGHT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_ICCPROFILE_::value_type>> const capability_interface& set_iccprofile(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ICCPROFILE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ICCPROFILE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_IMAGEDATASET_::value_type>> const capability_interface& set_imagedataset(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEDATASET_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEDATASET_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_IMAGEFILEFORMAT_::value_type>> const capability_interface& set_imagefileformat(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEFILEFORMAT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEFILEFORMAT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_IMAGEFILTER_::value_type>> const capability_interface& set_imagefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEFILTER_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_IMAGEMERGE_::value_type>> const capability_interface& set_imagemerge(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_IMAGEMERGEHEIGHTTHRESHOLD_::value_type>> const capability_interface& set_imagemergeheightthreshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_IMAGEMERGEHEIGHTTHRESHOLD_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_JPEGPIXELTYPE_::value_type>> const capability_interface& set_jpegpixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGPIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGPIXELTYPE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_JPEGQUALITY_::value_type>> const capability_interface& set_jpegquality(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGQUALITY_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGQUALITY_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_JPEGSUBSAMPLING_::value_type>> const capability_interface& set_jpegsubsampling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_JPEGSUBSAMPLING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_JPEGSUBSAMPLING_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_LAMPSTATE_::value_type>> const capability_interface& set_lampstate(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LAMPSTATE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LAMPSTATE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_LIGHTPATH_::value_type>> const capability_interface& set_lightpath(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LIGHTPATH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LIGHTPATH_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_LIGHTSOURCE_::value_type>> const capability_interface& set_lightsource(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_LIGHTSOURCE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_LIGHTSOURCE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_MAXFRAMES_::value_type>> const capability_interface& set_maxframes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MAXFRAMES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MAXFRAMES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_MINIMUMHEIGHT_::value_type>> const capability_interface& set_minimumheight(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MINIMUMHEIGHT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MINIMUMHEIGHT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_MINIMUMWIDTH_::value_type>> const capability_interface& set_minimumwidth(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MINIMUMWIDTH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MINIMUMWIDTH_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_MIRROR_::value_type>> const capability_interface& set_mirror(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_MIRROR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_MIRROR_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_NOISEFILTER_::value_type>> const capability_interface& set_noisefilter(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_NOISEFILTER_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_NOISEFILTER_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_ORIENTATION_::value_type>> const capability_interface& set_orientation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ORIENTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ORIENTATION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_OVERSCAN_::value_type>> const capability_interface& set_overscan(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_OVERSCAN_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_OVERSCAN_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODEDETECTIONENABLED_::value_type>> const capability_interface& set_patchcodedetectionenabled(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEDETECTIONENABLED_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEDETECTIONENABLED_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODEMAXRETRIES_::value_type>> const capability_interface& set_patchcodemaxretries(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXRETRIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXRETRIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODEMAXSEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodemaxsearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXSEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODEMAXSEARCHPRIORITIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODESEARCHMODE_::value_type>> const capability_interface& set_patchcodesearchmode(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHMODE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHMODE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODESEARCHPRIORITIES_::value_type>> const capability_interface& set_patchcodesearchpriorities(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHPRIORITIES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODESEARCHPRIORITIES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PATCHCODETIMEOUT_::value_type>> const capability_interface& set_patchcodetimeout(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PATCHCODETIMEOUT_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PATCHCODETIMEOUT_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PIXELFLAVOR_::value_type>> const capability_interface& set_pixelflavor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVOR_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PIXELFLAVORCODES_::value_type>> const capability_interface& set_pixelflavorcodes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVORCODES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELFLAVORCODES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PIXELTYPE_::value_type>> const capability_interface& set_pixeltype(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PIXELTYPE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PIXELTYPE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_PLANARCHUNKY_::value_type>> const capability_interface& set_planarchunky(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_PLANARCHUNKY_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_PLANARCHUNKY_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_ROTATION_::value_type>> const capability_interface& set_rotation(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ROTATION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ROTATION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_SHADOW_::value_type>> const capability_interface& set_shadow(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_SHADOW_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_SHADOW_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_SUPPORTEDSIZES_::value_type>> const capability_interface& set_supportedsizes(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_SUPPORTEDSIZES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_SUPPORTEDSIZES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_THRESHOLD_::value_type>> const capability_interface& set_threshold(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_THRESHOLD_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_THRESHOLD_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_TILES_::value_type>> const capability_interface& set_tiles(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_TILES_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_TILES_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_TIMEFILL_::value_type>> const capability_interface& set_timefill(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_TIMEFILL_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_TIMEFILL_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_UNDEFINEDIMAGESIZE_::value_type>> const capability_interface& set_undefinedimagesize(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_UNDEFINEDIMAGESIZE_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_UNDEFINEDIMAGESIZE_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_UNITS_::value_type>> const capability_interface& set_units(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_UNITS_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_UNITS_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_XFERMECH_::value_type>> const capability_interface& set_image_xfermech(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XFERMECH_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XFERMECH_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_XRESOLUTION_::value_type>> const capability_interface& set_xresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XRESOLUTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_XSCALING_::value_type>> const capability_interface& set_xscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_XSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_XSCALING_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_YRESOLUTION_::value_type>> const capability_interface& set_yresolution(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_YRESOLUTION_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_YRESOLUTION_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_YSCALING_::value_type>> const capability_interface& set_yscaling(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_YSCALING_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_YSCALING_>({}, reset()); return *this;}
+template <typename Container=twain_span<ICAP_ZOOMFACTOR_::value_type>> const capability_interface& set_zoomfactor(const Container& ct, const setcap_operation_info& scType = setcap_operation_info()) const { if (!ct.empty()) m_return_type = set_caps_impl<Container,ICAP_ZOOMFACTOR_>(ct, scType); else m_return_type = set_caps_impl<Container,ICAP_ZOOMFACTOR_>({}, reset()); return *this;}
 
 template <typename Container=ACAP_XFERMECH_::value_type> bool is_audio_xfermech_value_supported(const Container& c) const { return is_capvalue_supported<ACAP_XFERMECH_>(static_cast<dtwain_underlying_type<Container>::value_type>(c),0x1202); }
 template <typename Container=CAP_ALARMS_::value_type> bool is_alarms_value_supported(const Container& c) const { return is_capvalue_supported<CAP_ALARMS_>(static_cast<dtwain_underlying_type<Container>::value_type>(c),0x1018); }
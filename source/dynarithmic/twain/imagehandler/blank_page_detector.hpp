@@ -0,0 +1,384 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_BLANK_PAGE_DETECTOR_HPP
+#define DTWAIN_BLANK_PAGE_DETECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/imagehandler/pixel_kernels.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        struct blank_page_score
+        {
+            double ink_percent = 0;         ///< percentage of the examined area that is ink (a lower bound if decided_early)
+            double blank_percent = 100;     ///< 100 - ink_percent, comparable with the blank page threshold
+            bool is_blank = true;
+            bool decided_early = false;     ///< **true** if the page was found to have enough ink before all of it was examined
+            uint64_t ink_pixels = 0;
+            uint64_t examined_pixels = 0;   ///< pixels inside the margins
+        };
+
+        /// Row kernels used by blank_page_detector.  They use AVX2 or SSE2 on x86, chosen for the running CPU the first time
+        /// they are called, and NEON on ARM64.
+        struct blank_page_kernels
+        {
+            /// Returns the number of the **size** bytes at **p** that are less than **level**.  If **skip_alpha** is set,
+            /// every fourth byte (the unused byte of 32-bit pixels) is ignored.
+            static size_t count_below(const unsigned char* p, size_t size, unsigned char level, bool skip_alpha) noexcept
+            {
+                using func = size_t(*)(const unsigned char*, size_t, unsigned char, unsigned char);
+                #if defined(DTWAIN_PIXEL_KERNELS_X86)
+                static const func impl = cpu_features::get().avx2 ? &count_below_avx2 : &count_below_sse2;
+                #elif defined(DTWAIN_PIXEL_KERNELS_NEON)
+                static const func impl = &count_below_neon;
+                #else
+                static const func impl = &count_below_scalar;
+                #endif
+                if (level == 0)
+                    return 0;
+                // the unused byte is forced to 0xFF, which is never below the level
+                return impl(p, size, level, skip_alpha ? 0xFF : 0);
+            }
+
+            /// Returns the number of set bits in the **size** bytes at **p**
+            static size_t count_bits(const unsigned char* p, size_t size) noexcept
+            {
+                size_t count = 0;
+                size_t i = 0;
+                for (; i + 8 <= size; i += 8)
+                {
+                    uint64_t v;
+                    std::memcpy(&v, p + i, sizeof v);
+                    v = v - ((v >> 1) & 0x5555555555555555ULL);
+                    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+                    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+                    count += static_cast<size_t>((v * 0x0101010101010101ULL) >> 56);
+                }
+                for (; i < size; ++i)
+                {
+                    unsigned v = p[i];
+                    for (; v; v &= v - 1)
+                        ++count;
+                }
+                return count;
+            }
+
+            private:
+                // counts the bytes from **i** on, where **alpha** is the value the unused byte of 32-bit pixels is forced to
+                static size_t count_below_tail(const unsigned char* p, size_t i, size_t size, unsigned char level, unsigned char alpha) noexcept
+                {
+                    size_t count = 0;
+                    for (; i < size; ++i)
+                    {
+                        if (p[i] < level && !(alpha && (i & 3) == 3))
+                            ++count;
+                    }
+                    return count;
+                }
+
+                static size_t count_below_scalar(const unsigned char* p, size_t size, unsigned char level, unsigned char alpha) noexcept
+                {
+                    return count_below_tail(p, 0, size, level, alpha);
+                }
+
+                #if defined(DTWAIN_PIXEL_KERNELS_X86)
+                static size_t count_below_sse2(const unsigned char* p, size_t size, unsigned char level, unsigned char alpha) noexcept
+                {
+                    size_t count = 0;
+                    size_t i = 0;
+                    const __m128i limit = _mm_set1_epi8(static_cast<char>(level - 1));
+                    const __m128i mask = _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+                    const __m128i zero = _mm_setzero_si128();
+                    while (i + 16 <= size)
+                    {
+                        // each byte counter can take 255 blocks before it is summed
+                        __m128i counters = zero;
+                        const size_t end = (std::min)(size - 15, i + 255 * 16);
+                        for (; i < end; i += 16)
+                        {
+                            const __m128i v = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), mask);
+                            const __m128i below = _mm_cmpeq_epi8(_mm_min_epu8(v, limit), v);
+                            counters = _mm_sub_epi8(counters, below);
+                        }
+                        const __m128i sums = _mm_sad_epu8(counters, zero);
+                        count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+                    }
+                    return count + count_below_tail(p, i, size, level, alpha);
+                }
+
+                DTWAIN_TARGET_AVX2 static size_t count_below_avx2(const unsigned char* p, size_t size, unsigned char level, unsigned char alpha) noexcept
+                {
+                    size_t count = 0;
+                    size_t i = 0;
+                    const __m256i limit = _mm256_set1_epi8(static_cast<char>(level - 1));
+                    const __m256i mask = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(alpha) << 24));
+                    const __m256i zero = _mm256_setzero_si256();
+                    while (i + 32 <= size)
+                    {
+                        __m256i counters = zero;
+                        const size_t end = (std::min)(size - 31, i + 255 * 32);
+                        for (; i < end; i += 32)
+                        {
+                            const __m256i v = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), mask);
+                            const __m256i below = _mm256_cmpeq_epi8(_mm256_min_epu8(v, limit), v);
+                            counters = _mm256_sub_epi8(counters, below);
+                        }
+                        uint64_t sums[4];
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(counters, zero));
+                        count += static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+                    }
+                    return count + count_below_tail(p, i, size, level, alpha);
+                }
+                #elif defined(DTWAIN_PIXEL_KERNELS_NEON)
+                static size_t count_below_neon(const unsigned char* p, size_t size, unsigned char level, unsigned char alpha) noexcept
+                {
+                    size_t count = 0;
+                    size_t i = 0;
+                    const uint8x16_t limit = vdupq_n_u8(level);
+                    const uint8x16_t mask = vreinterpretq_u8_u32(vdupq_n_u32(static_cast<uint32_t>(alpha) << 24));
+                    while (i + 16 <= size)
+                    {
+                        uint8x16_t counters = vdupq_n_u8(0);
+                        const size_t end = (std::min)(size - 15, i + 255 * 16);
+                        for (; i < end; i += 16)
+                        {
+                            const uint8x16_t v = vorrq_u8(vld1q_u8(p + i), mask);
+                            counters = vsubq_u8(counters, vcltq_u8(v, limit));
+                        }
+                        count += static_cast<size_t>(vaddlvq_u8(counters));
+                    }
+                    return count + count_below_tail(p, i, size, level, alpha);
+                }
+                #endif
+        };
+
+        /// Decides whether acquired pages are blank, by counting the ink (dark pixels) inside the page margins.
+        ///
+        /// A pixel is ink if it is darker than the ink level.  Rows with no more ink pixels than the noise tolerance are
+        /// treated as clean, which ignores scanner noise and dust.  Examination stops as soon as the page has too much ink
+        /// to be blank, so pages with content are usually decided after a few rows.
+        ///
+        /// For color images each channel darker than the ink level counts as a third of a pixel.
+        ///
+        /// Pages are examined either whole with analyze(), or a strip at a time with begin_page(), add_rows() and finish().
+        class blank_page_detector
+        {
+            public:
+                static constexpr double default_threshold = 98.0;
+                static constexpr double default_margin = 2.0;
+                static constexpr unsigned char default_ink_level = 128;
+
+            private:
+                double m_threshold = default_threshold;
+                double m_margin = default_margin;
+                uint32_t m_noise_tolerance = 0;
+                unsigned char m_ink_level = default_ink_level;
+
+                struct page_state
+                {
+                    int32_t width = 0;
+                    int32_t height = 0;
+                    int32_t first_row = 0;      // rows and columns inside the margins
+                    int32_t last_row = 0;
+                    int32_t first_column = 0;
+                    int32_t last_column = 0;
+                    uint64_t area = 0;
+                    uint64_t max_ink = 0;       // the most ink a blank page can have
+                    uint64_t ink = 0;
+                    bool decided = false;
+                };
+                page_state m_state;
+
+                page_state start(int32_t width, int32_t height) const noexcept
+                {
+                    page_state state;
+                    state.width = width;
+                    state.height = height;
+                    const double margin = (std::min)((std::max)(m_margin, 0.0), 49.0) / 100.0;
+                    state.first_column = static_cast<int32_t>(width * margin);
+                    state.last_column = width - state.first_column;
+                    state.first_row = static_cast<int32_t>(height * margin);
+                    state.last_row = height - state.first_row;
+                    state.area = static_cast<uint64_t>((std::max)(state.last_column - state.first_column, 0)) *
+                                 static_cast<uint64_t>((std::max)(state.last_row - state.first_row, 0));
+                    const double ink_allowed = (100.0 - (std::min)((std::max)(m_threshold, 0.0), 100.0)) / 100.0;
+                    state.max_ink = static_cast<uint64_t>(state.area * ink_allowed);
+                    return state;
+                }
+
+                // returns the ink pixels in columns [first, last) of **row**
+                size_t count_row(const unsigned char* row, pixel_format format, int32_t first, int32_t last,
+                                 const unsigned char* ink_table) const noexcept
+                {
+                    const size_t columns = static_cast<size_t>(last - first);
+                    switch (format)
+                    {
+                        case pixel_format::gray8:
+                            return blank_page_kernels::count_below(row + first, columns, m_ink_level, false);
+                        case pixel_format::bgr24:
+                            return blank_page_kernels::count_below(row + static_cast<size_t>(first) * 3, columns * 3, m_ink_level, false) / 3;
+                        case pixel_format::bgrx32:
+                            return blank_page_kernels::count_below(row + static_cast<size_t>(first) * 4, columns * 4, m_ink_level, true) / 3;
+                        case pixel_format::bw1:
+                        {
+                            // whole bytes inside the margins
+                            const size_t first_byte = (static_cast<size_t>(first) + 7) / 8;
+                            const size_t last_byte = static_cast<size_t>(last) / 8;
+                            if (last_byte <= first_byte)
+                                return 0;
+                            const size_t bytes = last_byte - first_byte;
+                            const size_t set = blank_page_kernels::count_bits(row + first_byte, bytes);
+                            return ink_table[1] ? set : bytes * 8 - set;
+                        }
+                        case pixel_format::indexed4:
+                        {
+                            size_t count = 0;
+                            for (int32_t x = first; x < last; ++x)
+                                count += ink_table[(row[x / 2] >> ((x & 1) ? 0 : 4)) & 0x0F];
+                            return count;
+                        }
+                        case pixel_format::indexed8:
+                        {
+                            size_t count = 0;
+                            for (int32_t x = first; x < last; ++x)
+                                count += ink_table[row[x]];
+                            return count;
+                        }
+                        case pixel_format::bgr555:
+                        {
+                            size_t count = 0;
+                            const unsigned level = m_ink_level >> 3;
+                            for (int32_t x = first; x < last; ++x)
+                            {
+                                const unsigned v = row[2 * x] | (row[2 * x + 1] << 8);
+                                count += ((v & 0x1F) < level) + (((v >> 5) & 0x1F) < level) + (((v >> 10) & 0x1F) < level);
+                            }
+                            return count / 3;
+                        }
+                        default:
+                            return 0;
+                    }
+                }
+
+                // which palette entries are ink (bw1 and indexed formats)
+                void make_ink_table(const image_view& view, unsigned char* table) const noexcept
+                {
+                    std::memset(table, 0, 256);
+                    if (!view.palette)
+                    {
+                        // without a palette, 0 is black
+                        table[0] = 1;
+                        return;
+                    }
+                    for (uint32_t i = 0; i < view.palette_entries && i < 256; ++i)
+                    {
+                        const unsigned char* entry = view.palette + i * 4;
+                        const unsigned luminance = (entry[0] * 29u + entry[1] * 150u + entry[2] * 77u) >> 8;
+                        table[i] = luminance < m_ink_level ? 1 : 0;
+                    }
+                }
+
+                void add_rows(page_state& state, const image_view& rows, int32_t first_row) const noexcept
+                {
+                    if (state.decided || rows.empty())
+                        return;
+                    unsigned char ink_table[256];
+                    make_ink_table(rows, ink_table);
+                    const int32_t columns = (std::min)(state.last_column, rows.width);
+                    const int32_t begin = (std::max)(state.first_row - first_row, 0);
+                    const int32_t end = (std::min)(state.last_row - first_row, rows.height);
+                    for (int32_t y = begin; y < end && columns > state.first_column; ++y)
+                    {
+                        const size_t ink = count_row(rows.row(y), rows.format, state.first_column, columns, ink_table);
+                        if (ink > m_noise_tolerance)
+                            state.ink += ink;
+                        if (state.ink > state.max_ink)
+                        {
+                            state.decided = true;
+                            return;
+                        }
+                    }
+                }
+
+                static blank_page_score score(const page_state& state) noexcept
+                {
+                    blank_page_score result;
+                    result.ink_pixels = state.ink;
+                    result.examined_pixels = state.area;
+                    result.decided_early = state.decided;
+                    result.ink_percent = state.area ? 100.0 * static_cast<double>(state.ink) / static_cast<double>(state.area) : 0.0;
+                    result.blank_percent = 100.0 - result.ink_percent;
+                    result.is_blank = state.ink <= state.max_ink;
+                    return result;
+                }
+
+            public:
+                blank_page_detector() = default;
+                explicit blank_page_detector(double threshold) : m_threshold(threshold) {}
+
+                /// Sets the percentage of the page (inside the margins) that must be free of ink for the page to be blank
+                blank_page_detector& set_threshold(double threshold) noexcept { m_threshold = threshold; return *this; }
+
+                /// Sets the percentage of the width and height ignored at each edge of the page
+                blank_page_detector& set_margin(double percent) noexcept { m_margin = percent; return *this; }
+
+                /// Sets the number of ink pixels a row can have and still be treated as clean
+                blank_page_detector& set_noise_tolerance(uint32_t pixels) noexcept { m_noise_tolerance = pixels; return *this; }
+
+                /// Sets the level (0 - 255) below which a pixel or channel is ink
+                blank_page_detector& set_ink_level(unsigned char level) noexcept { m_ink_level = level; return *this; }
+
+                double get_threshold() const noexcept { return m_threshold; }
+                double get_margin() const noexcept { return m_margin; }
+                uint32_t get_noise_tolerance() const noexcept { return m_noise_tolerance; }
+                unsigned char get_ink_level() const noexcept { return m_ink_level; }
+
+                /// Examines the whole image **view**
+                blank_page_score analyze(const image_view& view) const noexcept
+                {
+                    page_state state = start(view.width, view.height);
+                    add_rows(state, view, 0);
+                    return score(state);
+                }
+
+                /// Starts examining a page of **width** x **height** pixels that arrives in strips
+                void begin_page(int32_t width, int32_t height) noexcept { m_state = start(width, height); }
+
+                /// Examines the strip **rows**, whose top row is row **first_row** of the page.
+                /// @returns **false** once the page is known not to be blank, so that later strips can be skipped.
+                bool add_rows(const image_view& rows, int32_t first_row) noexcept
+                {
+                    add_rows(m_state, rows, first_row);
+                    return !m_state.decided;
+                }
+
+                /// Returns the score of the page started by begin_page()
+                blank_page_score finish() const noexcept { return score(m_state); }
+        };
+    }
+}
+#endif
@@ -0,0 +1,356 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_COLOR_DETECTOR_HPP
+#define DTWAIN_COLOR_DETECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/imagehandler/pixel_kernels.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        enum class color_class : uint8_t
+        {
+            bitonal,    ///< only black and white (text, line art)
+            gray,       ///< shades of gray
+            color
+        };
+
+        struct color_analysis
+        {
+            color_class classification = color_class::color;
+            double color_percent = 0;       ///< pixels with visible color (a lower bound if decided_early)
+            double midtone_percent = 0;     ///< pixels that are neither dark nor light
+            bool decided_early = false;     ///< **true** if the page had enough color before all of it was examined
+            uint64_t pixels = 0;
+        };
+
+        /// Classifies a page as bitonal, gray or color, so that it can be stored in the cheapest pixel type.
+        ///
+        /// A pixel has color if its largest and smallest channels differ by more than the chroma tolerance.  A page with
+        /// more than the color threshold of such pixels is color.  Otherwise it is bitonal if fewer than the midtone
+        /// threshold of its pixels have a lightness between the dark and light levels, and gray if not.
+        ///
+        /// 24 and 32-bit rows are split into channels 16 pixels at a time with SSSE3, when the CPU has it.
+        class color_detector
+        {
+            public:
+                static constexpr unsigned char default_chroma_tolerance = 40;
+                static constexpr double default_color_threshold = 0.5;
+                static constexpr double default_midtone_threshold = 2.0;
+
+            private:
+                unsigned char m_chroma_tolerance = default_chroma_tolerance;
+                double m_color_threshold = default_color_threshold;
+                double m_midtone_threshold = default_midtone_threshold;
+                unsigned char m_dark_level = 64;
+                unsigned char m_light_level = 192;
+
+                struct counts
+                {
+                    uint64_t colored = 0;
+                    uint64_t midtones = 0;
+                };
+
+                void count_pixel(unsigned b, unsigned g, unsigned r, counts& c) const noexcept
+                {
+                    const unsigned high = (std::max)((std::max)(b, g), r);
+                    const unsigned low = (std::min)((std::min)(b, g), r);
+                    c.colored += (high - low > m_chroma_tolerance);
+                    const unsigned lightness = (high + low + 1) / 2;
+                    c.midtones += (lightness > m_dark_level && lightness < m_light_level);
+                }
+
+                void count_scalar(const unsigned char* row, size_t pixels, int bytes_per_pixel, counts& c) const noexcept
+                {
+                    for (size_t x = 0; x < pixels; ++x, row += bytes_per_pixel)
+                    {
+                        if (bytes_per_pixel == 1)
+                            c.midtones += (row[0] > m_dark_level && row[0] < m_light_level);
+                        else
+                            count_pixel(row[0], row[1], row[2], c);
+                    }
+                }
+
+                #ifdef DTWAIN_PIXEL_KERNELS_X86
+                // masks that gather channel c of 16 pixels from the bytes_per_pixel registers they span:
+                // masks[c][r] takes the bytes in register r
+                struct plane_masks
+                {
+                    alignas(16) unsigned char masks[3][4][16];
+                    explicit plane_masks(int bytes_per_pixel)
+                    {
+                        std::memset(masks, 0x80, sizeof masks);
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            for (int k = 0; k < 16; ++k)
+                            {
+                                const int src = k * bytes_per_pixel + c;
+                                masks[c][src / 16][k] = static_cast<unsigned char>(src % 16);
+                            }
+                        }
+                    }
+                };
+
+                DTWAIN_TARGET_SSSE3 static __m128i gather_plane(const __m128i* regs, const plane_masks& m, int c, int count) noexcept
+                {
+                    __m128i plane = _mm_setzero_si128();
+                    for (int r = 0; r < count; ++r)
+                        plane = _mm_or_si128(plane, _mm_shuffle_epi8(regs[r], _mm_load_si128(reinterpret_cast<const __m128i*>(m.masks[c][r]))));
+                    return plane;
+                }
+
+                DTWAIN_TARGET_SSSE3 size_t count_ssse3(const unsigned char* row, size_t pixels, int bytes_per_pixel, counts& c) const noexcept
+                {
+                    static const plane_masks masks24(3);
+                    static const plane_masks masks32(4);
+                    const plane_masks& m = bytes_per_pixel == 3 ? masks24 : masks32;
+                    const __m128i tolerance = _mm_set1_epi8(static_cast<char>(m_chroma_tolerance));
+                    // lightness is a midtone if dark < L < light, that is (L - dark - 1) <= (light - dark - 2) unsigned
+                    const __m128i dark = _mm_set1_epi8(static_cast<char>(m_dark_level + 1));
+                    const __m128i range = _mm_set1_epi8(static_cast<char>(m_light_level - m_dark_level - 2));
+                    const __m128i zero = _mm_setzero_si128();
+                    size_t x = 0;
+                    if (m_light_level < m_dark_level + 2)
+                        return 0;
+                    while (x + 16 <= pixels)
+                    {
+                        __m128i colored = zero;
+                        __m128i midtones = zero;
+                        const size_t end = (std::min)(pixels - 15, x + 255 * 16);
+                        for (; x < end; x += 16)
+                        {
+                            __m128i regs[4];
+                            const unsigned char* p = row + x * bytes_per_pixel;
+                            for (int r = 0; r < bytes_per_pixel; ++r)
+                                regs[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * r));
+                            const __m128i b = gather_plane(regs, m, 0, bytes_per_pixel);
+                            const __m128i g = gather_plane(regs, m, 1, bytes_per_pixel);
+                            const __m128i r = gather_plane(regs, m, 2, bytes_per_pixel);
+                            const __m128i high = _mm_max_epu8(_mm_max_epu8(b, g), r);
+                            const __m128i low = _mm_min_epu8(_mm_min_epu8(b, g), r);
+                            // chroma > tolerance  <=>  chroma - tolerance (saturated) != 0
+                            const __m128i has_color = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(high, low), tolerance), zero);
+                            colored = _mm_sub_epi8(colored, _mm_andnot_si128(has_color, _mm_set1_epi8(-1)));
+                            const __m128i offset = _mm_sub_epi8(_mm_avg_epu8(high, low), dark);
+                            const __m128i is_mid = _mm_cmpeq_epi8(_mm_min_epu8(offset, range), offset);
+                            midtones = _mm_sub_epi8(midtones, is_mid);
+                        }
+                        const __m128i colored_sums = _mm_sad_epu8(colored, zero);
+                        const __m128i midtone_sums = _mm_sad_epu8(midtones, zero);
+                        c.colored += static_cast<uint64_t>(_mm_cvtsi128_si32(colored_sums)) + static_cast<uint64_t>(_mm_cvtsi128_si32(_mm_srli_si128(colored_sums, 8)));
+                        c.midtones += static_cast<uint64_t>(_mm_cvtsi128_si32(midtone_sums)) + static_cast<uint64_t>(_mm_cvtsi128_si32(_mm_srli_si128(midtone_sums, 8)));
+                    }
+                    return x;
+                }
+                #endif
+
+                void count_row(const unsigned char* row, size_t pixels, int bytes_per_pixel, counts& c) const noexcept
+                {
+                    size_t done = 0;
+                    #ifdef DTWAIN_PIXEL_KERNELS_X86
+                    if (bytes_per_pixel >= 3 && cpu_features::get().ssse3)
+                        done = count_ssse3(row, pixels, bytes_per_pixel, c);
+                    #endif
+                    count_scalar(row + done * bytes_per_pixel, pixels - done, bytes_per_pixel, c);
+                }
+
+            public:
+                /// Sets the difference between the largest and smallest channel above which a pixel has color
+                color_detector& set_chroma_tolerance(unsigned char tolerance) noexcept { m_chroma_tolerance = tolerance; return *this; }
+
+                /// Sets the percentage of pixels with color above which a page is color
+                color_detector& set_color_threshold(double percent) noexcept { m_color_threshold = percent; return *this; }
+
+                /// Sets the percentage of midtone pixels above which a page without color is gray rather than bitonal
+                color_detector& set_midtone_threshold(double percent) noexcept { m_midtone_threshold = percent; return *this; }
+
+                /// Sets the lightness levels between which a pixel is a midtone
+                color_detector& set_midtone_levels(unsigned char dark, unsigned char light) noexcept
+                {
+                    m_dark_level = dark;
+                    m_light_level = light;
+                    return *this;
+                }
+
+                /// Classifies the image **view**.  Palette and 16-bit images are examined through their colors.
+                color_analysis analyze(const image_view& view) const
+                {
+                    color_analysis result;
+                    if (view.empty())
+                        return result;
+                    const uint64_t area = static_cast<uint64_t>(view.width) * static_cast<uint64_t>(view.height);
+                    const uint64_t max_colored = static_cast<uint64_t>(area * (std::max)(m_color_threshold, 0.0) / 100.0);
+                    result.pixels = area;
+
+                    std::vector<unsigned char> converted;
+                    std::vector<unsigned char> indexes;
+                    uint32_t palette[256] = {};
+                    int bytes_per_pixel = 3;
+                    switch (view.format)
+                    {
+                        case pixel_format::gray8:  bytes_per_pixel = 1; break;
+                        case pixel_format::bgr24:  bytes_per_pixel = 3; break;
+                        case pixel_format::bgrx32: bytes_per_pixel = 4; break;
+                        default:
+                            // other formats are converted a row at a time to bgr24
+                            converted.resize(static_cast<size_t>(view.width) * 3);
+                            indexes.resize(static_cast<size_t>(view.width));
+                            for (uint32_t i = 0; view.palette && i < view.palette_entries && i < 256; ++i)
+                                std::memcpy(&palette[i], view.palette + i * 4, 4);
+                            if (!view.palette)
+                                palette[1] = 0xFFFFFF;
+                        break;
+                    }
+
+                    counts c;
+                    for (int32_t y = 0; y < view.height; ++y)
+                    {
+                        const unsigned char* row = view.row(y);
+                        if (!converted.empty())
+                        {
+                            if (view.format == pixel_format::bgr555)
+                            {
+                                for (int32_t x = 0; x < view.width; ++x)
+                                {
+                                    const unsigned v = row[2 * x] | (row[2 * x + 1] << 8);
+                                    converted[3 * x] = static_cast<unsigned char>((v & 0x1F) << 3);
+                                    converted[3 * x + 1] = static_cast<unsigned char>(((v >> 5) & 0x1F) << 3);
+                                    converted[3 * x + 2] = static_cast<unsigned char>(((v >> 10) & 0x1F) << 3);
+                                }
+                            }
+                            else
+                            {
+                                pixel_kernels::unpack_indexes(row, indexes.data(), indexes.size(), view.bits_per_pixel());
+                                pixel_kernels::expand_palette24(indexes.data(), converted.data(), indexes.size(), palette);
+                            }
+                            row = converted.data();
+                        }
+                        count_row(row, static_cast<size_t>(view.width), bytes_per_pixel, c);
+                        if (c.colored > max_colored)
+                        {
+                            result.decided_early = y + 1 < view.height;
+                            break;
+                        }
+                    }
+                    result.color_percent = 100.0 * static_cast<double>(c.colored) / static_cast<double>(area);
+                    result.midtone_percent = 100.0 * static_cast<double>(c.midtones) / static_cast<double>(area);
+                    if (c.colored > max_colored)
+                        result.classification = color_class::color;
+                    else if (result.midtone_percent > m_midtone_threshold)
+                        result.classification = color_class::gray;
+                    else
+                        result.classification = color_class::bitonal;
+                    return result;
+                }
+
+                /// Returns a new DIB of the image **view** converted to **target** (gray: 8-bit gray, bitonal: 1-bit, 0 is black).
+                /// Bitonal pixels are white if their lightness is at least **threshold**.
+                /// @returns an empty vector if **target** is color or the view is empty.
+                static std::vector<unsigned char> convert(const image_view& view, color_class target, unsigned char threshold = 128)
+                {
+                    std::vector<unsigned char> dib;
+                    if (view.empty() || target == color_class::color)
+                        return dib;
+                    const bool gray = target == color_class::gray;
+                    const uint32_t palette_entries = gray ? 256 : 2;
+                    const uint32_t row_bytes = ((static_cast<uint32_t>(view.width) * (gray ? 8 : 1) + 31) / 32) * 4;
+                    const uint32_t header_size = 40 + palette_entries * 4;
+                    dib.assign(header_size + static_cast<size_t>(row_bytes) * view.height, 0);
+
+                    auto put32 = [&](size_t offset, uint32_t value) { for (int i = 0; i < 4; ++i) dib[offset + i] = static_cast<unsigned char>(value >> (8 * i)); };
+                    put32(0, 40);
+                    put32(4, static_cast<uint32_t>(view.width));
+                    put32(8, static_cast<uint32_t>(view.height));
+                    dib[12] = 1;
+                    dib[14] = gray ? 8 : 1;
+                    put32(20, row_bytes * static_cast<uint32_t>(view.height));
+                    put32(24, static_cast<uint32_t>(view.x_resolution / 0.0254 + 0.5));
+                    put32(28, static_cast<uint32_t>(view.y_resolution / 0.0254 + 0.5));
+                    put32(32, palette_entries);
+                    for (uint32_t i = 0; i < palette_entries; ++i)
+                    {
+                        const unsigned char level = static_cast<unsigned char>(gray ? i : i * 255);
+                        dib[40 + i * 4] = dib[41 + i * 4] = dib[42 + i * 4] = level;
+                    }
+
+                    // lightness of each pixel of a row, through bgr24
+                    std::vector<unsigned char> bgr(static_cast<size_t>(view.width) * 3);
+                    std::vector<unsigned char> indexes(static_cast<size_t>(view.width));
+                    uint32_t palette[256] = {};
+                    for (uint32_t i = 0; view.palette && i < view.palette_entries && i < 256; ++i)
+                        std::memcpy(&palette[i], view.palette + i * 4, 4);
+                    if (!view.palette)
+                        palette[1] = 0xFFFFFF;
+
+                    for (int32_t y = 0; y < view.height; ++y)
+                    {
+                        const unsigned char* src = view.row(y);
+                        // DIB rows are bottom-up
+                        unsigned char* dest = &dib[header_size + static_cast<size_t>(view.height - 1 - y) * row_bytes];
+                        for (int32_t x = 0; x < view.width; ++x)
+                        {
+                            unsigned b, g, r;
+                            switch (view.format)
+                            {
+                                case pixel_format::gray8:
+                                    b = g = r = src[x];
+                                break;
+                                case pixel_format::bgr24:
+                                    b = src[3 * x]; g = src[3 * x + 1]; r = src[3 * x + 2];
+                                break;
+                                case pixel_format::bgrx32:
+                                    b = src[4 * x]; g = src[4 * x + 1]; r = src[4 * x + 2];
+                                break;
+                                case pixel_format::bgr555:
+                                {
+                                    const unsigned v = src[2 * x] | (src[2 * x + 1] << 8);
+                                    b = (v & 0x1F) << 3; g = ((v >> 5) & 0x1F) << 3; r = ((v >> 10) & 0x1F) << 3;
+                                }
+                                break;
+                                default:
+                                {
+                                    if (x == 0)
+                                        pixel_kernels::unpack_indexes(src, indexes.data(), indexes.size(), view.bits_per_pixel());
+                                    const uint32_t entry = palette[indexes[x]];
+                                    b = entry & 0xFF; g = (entry >> 8) & 0xFF; r = (entry >> 16) & 0xFF;
+                                }
+                                break;
+                            }
+                            const unsigned luminance = (b * 29u + g * 150u + r * 77u) >> 8;
+                            if (gray)
+                                dest[x] = static_cast<unsigned char>(luminance);
+                            else if (luminance >= threshold)
+                                dest[x / 8] |= static_cast<unsigned char>(0x80 >> (x & 7));
+                        }
+                    }
+                    return dib;
+                }
+        };
+    }
+}
+#endif
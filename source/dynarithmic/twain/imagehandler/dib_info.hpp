@@ -0,0 +1,119 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_DIB_INFO_HPP
+#define DTWAIN_DIB_INFO_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Layout of a Device Independent Bitmap (a BITMAPINFOHEADER, optional color table, and the pixel rows).
+        ///
+        /// The layout is read from the bytes of the DIB, so it can be used on DIBs held in memory-mapped files and on
+        /// platforms without the Windows headers.
+        struct dib_info
+        {
+            int32_t width = 0;
+            int32_t height = 0;             ///< always positive; see is_bottom_up
+            uint16_t bits_per_pixel = 0;
+            uint32_t compression = 0;       ///< 0 (BI_RGB) or 3 (BI_BITFIELDS) for uncompressed DIBs
+            uint32_t header_size = 0;       ///< bytes before the pixel data (header, bit fields and color table)
+            uint32_t palette_offset = 0;    ///< offset of the color table (after the header and bit fields)
+            uint32_t palette_entries = 0;   ///< usable color table entries, at most 2 to the power of bits_per_pixel
+            uint32_t row_bytes = 0;         ///< bytes of each row, including the padding to a 4-byte boundary
+            bool is_bottom_up = true;       ///< **true** if the first row in memory is the bottom row of the image
+            double x_resolution = 0;        ///< dots per inch
+            double y_resolution = 0;
+
+            /// Returns the distance in bytes from one row (top to bottom) to the next.  Negative for bottom-up DIBs.
+            int64_t get_stride() const noexcept { return is_bottom_up ? -static_cast<int64_t>(row_bytes) : static_cast<int64_t>(row_bytes); }
+
+            /// Returns the bytes of the pixel data
+            size_t get_image_size() const noexcept { return static_cast<size_t>(row_bytes) * static_cast<size_t>(height); }
+
+            /// Reads the layout of the DIB at **data**, which has **size** bytes.
+            /// @returns **true** if **data** holds a complete, uncompressed DIB.
+            /// @note The sizes are computed in 64 bits, so that a header with a very large width or color count cannot
+            /// wrap around and pass the check against **size**.
+            bool parse(const void* data, size_t size)
+            {
+                *this = dib_info();
+                const unsigned char* p = static_cast<const unsigned char*>(data);
+                if (!p || size < 40)
+                    return false;
+                const uint32_t bi_size = read<uint32_t>(p, 0);
+                if (bi_size < 40 || bi_size > size)
+                    return false;
+                width = read<int32_t>(p, 4);
+                const int32_t bi_height = read<int32_t>(p, 8);
+                bits_per_pixel = read<uint16_t>(p, 14);
+                compression = read<uint32_t>(p, 16);
+                const uint32_t clr_used = read<uint32_t>(p, 32);
+                if (width <= 0 || bi_height == 0 || bits_per_pixel == 0 || (compression != 0 && compression != 3))
+                    return false;
+
+                is_bottom_up = bi_height > 0;
+                height = is_bottom_up ? bi_height : -bi_height;
+
+                // the color table holds biClrUsed entries, but an image can only index 2^bits_per_pixel of them
+                const uint64_t max_entries = bits_per_pixel <= 8 ? (uint64_t(1) << bits_per_pixel) : 0;
+                const uint64_t table_entries = clr_used ? clr_used : max_entries;
+                const uint64_t table_offset = uint64_t(bi_size) + ((compression == 3 && bi_size == 40) ? 12 : 0);
+                const uint64_t header_bytes = table_offset + table_entries * 4;
+                const uint64_t row_size = ((uint64_t(width) * bits_per_pixel + 31) / 32) * 4;
+                const uint64_t image_bytes = row_size * uint64_t(height);
+                if (header_bytes > size || row_size > size || image_bytes > size - header_bytes)
+                    return false;
+
+                palette_offset = static_cast<uint32_t>(table_offset);
+                palette_entries = static_cast<uint32_t>((std::min)(table_entries, max_entries));
+                header_size = static_cast<uint32_t>(header_bytes);
+                row_bytes = static_cast<uint32_t>(row_size);
+
+                // resolution is stored in pixels per meter
+                x_resolution = read<int32_t>(p, 24) * 0.0254;
+                y_resolution = read<int32_t>(p, 28) * 0.0254;
+                return true;
+            }
+
+            private:
+                template <typename T>
+                static T read(const unsigned char* p, size_t offset)
+                {
+                    // DIB fields are little-endian
+                    uint64_t bits = 0;
+                    for (size_t i = 0; i < sizeof(T); ++i)
+                        bits |= static_cast<uint64_t>(p[offset + i]) << (8 * i);
+                    typename std::make_unsigned<T>::type ubits = static_cast<typename std::make_unsigned<T>::type>(bits);
+                    T value;
+                    std::memcpy(&value, &ubits, sizeof(T));
+                    return value;
+                }
+        };
+    }
+}
+#endif
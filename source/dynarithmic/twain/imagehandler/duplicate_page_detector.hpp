@@ -0,0 +1,185 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_DUPLICATE_PAGE_DETECTOR_HPP
+#define DTWAIN_DUPLICATE_PAGE_DETECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <dynarithmic/twain/imagehandler/thumbnail_generator.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A 256-bit difference hash of a page.  The page is reduced to 17 x 16 gray cells, and each bit tells whether a
+        /// cell is lighter than its right neighbor, so the hash survives changes of resolution, brightness and compression.
+        struct page_hash
+        {
+            static constexpr int columns = 16;
+            static constexpr int rows = 16;
+
+            std::array<uint64_t, 4> bits = {};
+            bool flat = true;       ///< **true** if the page has too little contrast to be told apart from other flat pages
+
+            /// Returns the number of bits that differ between **left** and **right** (0 to 256)
+            static int distance(const page_hash& left, const page_hash& right) noexcept
+            {
+                int result = 0;
+                for (size_t i = 0; i < left.bits.size(); ++i)
+                    result += static_cast<int>(std::bitset<64>(left.bits[i] ^ right.bits[i]).count());
+                return result;
+            }
+
+            /// Returns the hash of the image **view**, which is usually a thumbnail of the page
+            static page_hash compute(const image_view& view) noexcept
+            {
+                page_hash result;
+                if (view.empty() || (view.format != pixel_format::gray8 && view.format != pixel_format::bgr24))
+                    return result;
+                const int channels = view.format == pixel_format::gray8 ? 1 : 3;
+                unsigned cells[rows][columns + 1];
+                unsigned lowest = 255, highest = 0;
+                for (int cy = 0; cy < rows; ++cy)
+                {
+                    const int32_t y0 = cy * view.height / rows;
+                    const int32_t y1 = (std::max)(y0 + 1, (cy + 1) * view.height / rows);
+                    for (int cx = 0; cx <= columns; ++cx)
+                    {
+                        const int32_t x0 = cx * view.width / (columns + 1);
+                        const int32_t x1 = (std::max)(x0 + 1, (cx + 1) * view.width / (columns + 1));
+                        uint32_t sum = 0;
+                        for (int32_t y = y0; y < y1; ++y)
+                        {
+                            const unsigned char* row = view.row(y);
+                            for (int32_t x = x0; x < x1; ++x)
+                            {
+                                const unsigned char* p = row + x * channels;
+                                sum += channels == 1 ? p[0] : (p[0] * 29u + p[1] * 150u + p[2] * 77u) >> 8;
+                            }
+                        }
+                        const unsigned mean = sum / static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+                        cells[cy][cx] = mean;
+                        lowest = (std::min)(lowest, mean);
+                        highest = (std::max)(highest, mean);
+                    }
+                }
+                for (int cy = 0; cy < rows; ++cy)
+                {
+                    for (int cx = 0; cx < columns; ++cx)
+                    {
+                        if (cells[cy][cx] > cells[cy][cx + 1])
+                        {
+                            const int bit = cy * columns + cx;
+                            result.bits[bit / 64] |= uint64_t(1) << (bit % 64);
+                        }
+                    }
+                }
+                result.flat = highest - lowest < 8;
+                return result;
+            }
+        };
+
+        /// The outcome of comparing a page with the recent pages of its batch
+        struct duplicate_page_result
+        {
+            page_hash hash;
+            size_t page_number = 0;             ///< 0-based position of the page in the batch
+            bool is_duplicate = false;
+            int distance = -1;                  ///< distance to the closest recent page, -1 if there was none
+            size_t closest_page = 0;            ///< page number of the closest recent page
+        };
+
+        /// Finds pages that are near-identical to one of the last few pages of a batch, such as a sheet that was fed
+        /// twice or scanned again.  Each page is reduced to a page_hash, so comparing a page with the recent pages takes
+        /// about a microsecond.  Flat (blank or nearly uniform) pages are never reported as duplicates, since they
+        /// all look alike; blank_page_detector is the tool for those.
+        class duplicate_page_detector
+        {
+            public:
+                static constexpr size_t default_window = 8;
+                static constexpr int default_max_distance = 24;
+
+            private:
+                size_t m_window = default_window;
+                int m_max_distance = default_max_distance;
+                size_t m_pages = 0;
+                std::deque<std::pair<page_hash, size_t>> m_recent;
+                thumbnail_generator m_generator;
+
+            public:
+                duplicate_page_detector()
+                {
+                    m_generator.set_max_size(128, 128);
+                }
+
+                /// Sets the number of preceding pages that a page is compared with
+                duplicate_page_detector& set_window(size_t pages) noexcept { m_window = (std::max)(pages, size_t(1)); return *this; }
+
+                /// Sets the largest distance (0 to 256) at which two pages are duplicates
+                duplicate_page_detector& set_max_distance(int distance) noexcept { m_max_distance = distance; return *this; }
+
+                /// Starts a new batch
+                void reset() noexcept
+                {
+                    m_pages = 0;
+                    m_recent.clear();
+                }
+
+                /// Compares the page with hash **hash** with the recent pages, and adds it to them.  A duplicate is not
+                /// added, so a sheet fed three times is reported twice against the first copy.
+                duplicate_page_result add(const page_hash& hash)
+                {
+                    duplicate_page_result result;
+                    result.hash = hash;
+                    result.page_number = m_pages++;
+                    for (const auto& recent : m_recent)
+                    {
+                        const int distance = page_hash::distance(hash, recent.first);
+                        if (result.distance < 0 || distance < result.distance)
+                        {
+                            result.distance = distance;
+                            result.closest_page = recent.second;
+                        }
+                    }
+                    result.is_duplicate = !hash.flat && result.distance >= 0 && result.distance <= m_max_distance;
+                    if (!result.is_duplicate)
+                    {
+                        m_recent.emplace_back(hash, result.page_number);
+                        if (m_recent.size() > m_window)
+                            m_recent.pop_front();
+                    }
+                    return result;
+                }
+
+                /// Hashes the page **view** from a 128 x 128 thumbnail and compares it with the recent pages
+                duplicate_page_result add(const image_view& view)
+                {
+                    const thumbnail thumb = m_generator.generate(view);
+                    return add(page_hash::compute(thumb.get_view()));
+                }
+        };
+    }
+}
+#endif
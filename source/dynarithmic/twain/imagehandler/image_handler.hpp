@@ -21,6 +21,7 @@ OF THIRD PARTY RIGHTS.
 #ifndef DTWAIN_IMAGE_HANDLER_HPP
 #define DTWAIN_IMAGE_HANDLER_HPP
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 #include <memory>
@@ -28,6 +29,12 @@ OF THIRD PARTY RIGHTS.
 #include <dtwain.h>
 
 #include <dynarithmic/twain/dtwain_twain.hpp>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/imagehandler/mapped_page_store.hpp>
+#include <dynarithmic/twain/imagehandler/page_compression_store.hpp>
+#include <dynarithmic/twain/imagehandler/page_spill_store.hpp>
+#include <dynarithmic/twain/imagehandler/pixel_kernels.hpp>
+#include <dynarithmic/twain/source/memory_budget.hpp>
 
 namespace dynarithmic
 {
@@ -48,6 +55,76 @@ namespace dynarithmic
             friend std::ostream& operator <<(std::ostream& os, const image_information& ii);
         };
 
+        // A view of the pixels of a DIB that keeps the DIB locked, and keeps it from being spilled to disk or compressed,
+        // until the view is destroyed.  Returned by image_handler::get_image_view().  The image_view must not be used
+        // after the locked_image_view that it came from is destroyed.
+        class locked_image_view
+        {
+            HANDLE m_hDib = nullptr;
+            image_view m_view;
+
+            void release() noexcept
+            {
+                if (!m_hDib)
+                    return;
+                ::GlobalUnlock(m_hDib);
+                page_spill_store::unpin(m_hDib);
+                m_hDib = nullptr;
+                m_view = image_view();
+            }
+
+        public:
+            locked_image_view() = default;
+
+            // A view of memory that is not held by a DIB handle, such as a page of a mapped_page_store
+            explicit locked_image_view(const image_view& view) noexcept : m_view(view) {}
+
+            // Restores **hDib** if it was spilled or compressed, and locks it.  The view is empty if it could not be restored.
+            explicit locked_image_view(HANDLE hDib)
+            {
+                // a page that has been accessed is never compressed again, so it only needs to be pinned against spilling
+                if (!hDib || !page_spill_store::pin(hDib))
+                    return;
+                const void* p = page_compression_store::ensure_resident(hDib) ? ::GlobalLock(hDib) : nullptr;
+                if (!p)
+                {
+                    page_spill_store::unpin(hDib);
+                    return;
+                }
+                m_hDib = hDib;
+                m_view = image_view::from_dib(p, static_cast<size_t>(::GlobalSize(hDib)));
+            }
+
+            locked_image_view(locked_image_view&& rhs) noexcept : m_hDib(rhs.m_hDib), m_view(rhs.m_view)
+            {
+                rhs.m_hDib = nullptr;
+                rhs.m_view = image_view();
+            }
+
+            locked_image_view& operator=(locked_image_view&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    release();
+                    m_hDib = rhs.m_hDib;
+                    m_view = rhs.m_view;
+                    rhs.m_hDib = nullptr;
+                    rhs.m_view = image_view();
+                }
+                return *this;
+            }
+
+            locked_image_view(const locked_image_view&) = delete;
+            locked_image_view& operator=(const locked_image_view&) = delete;
+            ~locked_image_view() { release(); }
+
+            const image_view& get() const noexcept { return m_view; }
+            const image_view& operator*() const noexcept { return m_view; }
+            const image_view* operator->() const noexcept { return &m_view; }
+            bool empty() const noexcept { return m_view.empty(); }
+            explicit operator bool() const noexcept { return !empty(); }
+        };
+
         // image handler class that is created after a device acquires images to memory.
         // Note that this has only been tested in Windows, as it uses the Device Independent
         // Bitmap (DIB) type.  
@@ -57,12 +134,78 @@ namespace dynarithmic
             std::shared_ptr<images_vector> vect_image_handle_ptr;
             std::vector<HANDLE> dummy;
             bool m_bAutoDestroy;
+            std::shared_ptr<memory_budget> m_memory_budget;
+            // spill stores of the pages held, kept alive so that spilled pages can be restored
+            std::vector<std::shared_ptr<page_spill_store>> m_spill_stores;
+            // store that spills the pages added to this handler, if any
+            std::shared_ptr<page_spill_store> m_spill_store;
+            // compression stores of the pages held, kept alive so that compressed pages can be restored
+            std::vector<std::shared_ptr<page_compression_store>> m_compression_stores;
+            // store that compresses the pages added to this handler, if any
+            std::shared_ptr<page_compression_store> m_compression_store;
+            // page store backing this handler, and the store index of each page.  Handles of stored pages are
+            // only created when they are requested.
+            std::shared_ptr<mapped_page_store> m_page_store;
+            std::vector<std::vector<size_t>> m_store_pages;
+
+            void add_spilled_page(HANDLE h)
+            {
+                if (!h)
+                    return;
+                m_spill_store->add_page(h);
+                if (std::find(m_spill_stores.begin(), m_spill_stores.end(), m_spill_store) == m_spill_stores.end())
+                    m_spill_stores.push_back(m_spill_store);
+            }
+
+            void add_compressed_page(HANDLE h)
+            {
+                if (!h)
+                    return;
+                m_compression_store->add_page(h);
+                if (std::find(m_compression_stores.begin(), m_compression_stores.end(), m_compression_store) == m_compression_stores.end())
+                    m_compression_stores.push_back(m_compression_store);
+            }
+
+            HANDLE materialize(size_t acquisition, size_t page) const
+            {
+                HANDLE& h = (*vect_image_handle_ptr)[acquisition][page];
+                if (!h)
+                    h = m_page_store->copy_to_handle(m_store_pages[acquisition][page]);
+                return h;
+            }
 
         public:
             image_handler(bool containsImages=true) : vect_image_handle_ptr(containsImages ? new images_vector : nullptr),
                                                                        m_bAutoDestroy(false)
             {}
 
+            // Creates a handler for the pages in a mapped_page_store.  Acquisitions and pages are ordered as they
+            // are numbered in the store.
+            explicit image_handler(std::shared_ptr<mapped_page_store> store) : vect_image_handle_ptr(new images_vector),
+                                                                               m_bAutoDestroy(false),
+                                                                               m_page_store(std::move(store))
+            {
+                if (!m_page_store)
+                    return;
+                const auto index = m_page_store->get_index();
+                std::vector<uint32_t> acquisitions;
+                for (auto& entry : index)
+                    acquisitions.push_back(entry.acquisition);
+                std::sort(acquisitions.begin(), acquisitions.end());
+                acquisitions.erase(std::unique(acquisitions.begin(), acquisitions.end()), acquisitions.end());
+
+                m_store_pages.resize(acquisitions.size());
+                for (size_t i = 0; i < index.size(); ++i)
+                {
+                    const size_t acq = std::lower_bound(acquisitions.begin(), acquisitions.end(), index[i].acquisition) - acquisitions.begin();
+                    m_store_pages[acq].push_back(i);
+                }
+                for (auto& pages : m_store_pages)
+                    std::stable_sort(pages.begin(), pages.end(), [&](size_t a, size_t b) { return index[a].page < index[b].page; });
+                for (auto& pages : m_store_pages)
+                    vect_image_handle_ptr->push_back(std::vector<HANDLE>(pages.size(), nullptr));
+            }
+
             size_t get_num_acquisitions() const { return vect_image_handle_ptr->size(); }
             size_t size() const { return get_num_acquisitions(); }
 
@@ -77,6 +220,46 @@ namespace dynarithmic
                 return *this;
             }
 
+            // Compresses the pages held by this handler (and pages added later) in the background with **store**.  Every
+            // access to a page through the handler restores it first, so pages must not be used through other copies of
+            // their handles once they are compressed.
+            image_handler& set_compression_store(std::shared_ptr<page_compression_store> store)
+            {
+                m_compression_store = std::move(store);
+                if (!m_compression_store || !vect_image_handle_ptr)
+                    return *this;
+                for (auto& acquisition : *vect_image_handle_ptr)
+                {
+                    for (HANDLE h : acquisition)
+                        add_compressed_page(h);
+                }
+                return *this;
+            }
+
+            // Spills the pages held by this handler (and pages added later) with **store** once too many are in memory.  Every
+            // access to a page through the handler restores it first, so pages must not be used through other copies of
+            // their handles once they are spilled.
+            image_handler& set_spill_store(std::shared_ptr<page_spill_store> store)
+            {
+                m_spill_store = std::move(store);
+                if (!m_spill_store || !vect_image_handle_ptr)
+                    return *this;
+                for (auto& acquisition : *vect_image_handle_ptr)
+                {
+                    for (HANDLE h : acquisition)
+                        add_spilled_page(h);
+                }
+                return *this;
+            }
+
+            // Images destroyed by destroy_image_handles() are released from this budget
+            // (normally twain_source::get_shared_memory_budget())
+            image_handler& set_memory_budget(std::shared_ptr<memory_budget> budget)
+            {
+                m_memory_budget = std::move(budget);
+                return *this;
+            }
+
             size_t get_num_pages(size_t acq_number) const
             {
                 if (acq_number >= vect_image_handle_ptr->size())
@@ -84,6 +267,10 @@ namespace dynarithmic
                 return (*vect_image_handle_ptr)[acq_number].size();
             }
 
+            // Returns the handles of the pages of an acquisition.  Pages that are spilled to disk or compressed are not
+            // restored, and pages of a page store are nullptr until they are copied to a DIB by get_image_handle(), so that
+            // a large acquisition is not brought into memory at once: use get_image_handle(), get_image_view() or
+            // get_image_as_BMP() to access such pages one at a time.
             const std::vector<HANDLE>& get_acquisition_images(size_t acq_number) const
             {
                 if (get_num_pages(acq_number) == 0)
@@ -91,13 +278,54 @@ namespace dynarithmic
                 return (*vect_image_handle_ptr)[acq_number];
             }
 
-            // Return a specific DIB
+            // Returns a DIB, restoring it if it was spilled to disk or compressed.  Returns nullptr if the page could not
+            // be restored.  The DIB stays in memory until other pages are accessed.
             HANDLE get_image_handle(size_t acquisition, size_t page) const
             {
-                auto& images = get_acquisition_images(acquisition);
-                if (page < images.size())
-                    return images[page];
-                return nullptr;
+                if (get_num_pages(acquisition) <= page)
+                    return nullptr;
+                if (m_page_store)
+                    return materialize(acquisition, page);
+                return ensure_resident((*vect_image_handle_ptr)[acquisition][page]);
+            }
+
+            // Restores the DIB **hDib** if it was spilled to disk or compressed.  Returns nullptr if it could not be restored.
+            static HANDLE ensure_resident(HANDLE hDib)
+            {
+                if (hDib)
+                    hDib = page_spill_store::ensure_resident(hDib);
+                if (hDib)
+                    hDib = page_compression_store::ensure_resident(hDib);
+                return hDib;
+            }
+
+            // Returns a page of the backing page store in place, without copying it to a DIB handle.  The
+            // returned pointers are valid until a page is added to the store.
+            mapped_page_store::page_data get_stored_page(size_t acquisition, size_t page) const
+            {
+                if (!m_page_store || get_num_pages(acquisition) <= page)
+                    return {};
+                return m_page_store->get_page(m_store_pages[acquisition][page]);
+            }
+
+            std::shared_ptr<mapped_page_store> get_page_store() const noexcept { return m_page_store; }
+
+            // Returns a view of the pixels of a DIB, without copying them.  The DIB is locked, and kept in memory, until
+            // the returned view is destroyed.
+            static locked_image_view get_image_view(HANDLE hDib)
+            {
+                return locked_image_view(hDib);
+            }
+
+            // Returns a view of the pixels of a page.  Pages of a page store are viewed in place in the store, and the
+            // view is valid until a page is added to the store.
+            locked_image_view get_image_view(size_t acquisition, size_t page) const
+            {
+                if (m_page_store)
+                    return locked_image_view(get_stored_page(acquisition, page).get_view());
+                if (get_num_pages(acquisition) <= page)
+                    return {};
+                return locked_image_view((*vect_image_handle_ptr)[acquisition][page]);
             }
 
             HANDLE operator() (size_t row, size_t col) const
@@ -114,7 +342,7 @@ namespace dynarithmic
             std::vector<unsigned char> get_image_as_BMP(HANDLE hDib) const
             {
                 std::vector<unsigned char> retval;
-                if (!hDib)
+                if (!ensure_resident(hDib))
                     return retval;
                 BITMAPFILEHEADER fileheader;
                 LPBITMAPINFOHEADER lpbi = NULL;
@@ -145,7 +373,15 @@ namespace dynarithmic
 
             HANDLE flip_BMP_image(HANDLE hDib)
             {
-                API_INSTANCE DTWAIN_FlipBitmap(hDib);
+                if (!ensure_resident(hDib))
+                    return nullptr;
+                // uncompressed DIBs are flipped in place; anything else is left to DTWAIN
+                void* p = ::GlobalLock(hDib);
+                const bool flipped = p && pixel_kernels::flip_dib(p, static_cast<size_t>(::GlobalSize(hDib)));
+                if (p)
+                    ::GlobalUnlock(hDib);
+                if (!flipped)
+                    API_INSTANCE DTWAIN_FlipBitmap(hDib);
                 return hDib;
             }
 
@@ -163,6 +399,16 @@ namespace dynarithmic
             void push_back_image(HANDLE h)
             {
                 vect_image_handle_ptr->back().push_back(h);
+                auto store = page_spill_store::find_store(h);
+                if (store && std::find(m_spill_stores.begin(), m_spill_stores.end(), store) == m_spill_stores.end())
+                    m_spill_stores.push_back(std::move(store));
+                auto compression_store = page_compression_store::find_store(h);
+                if (compression_store && std::find(m_compression_stores.begin(), m_compression_stores.end(), compression_store) == m_compression_stores.end())
+                    m_compression_stores.push_back(std::move(compression_store));
+                if (m_spill_store)
+                    add_spilled_page(h);
+                if (m_compression_store)
+                    add_compressed_page(h);
             }
 
             void destroy_image_handles()
@@ -176,6 +422,15 @@ namespace dynarithmic
                         auto inner = vImages.begin();
                         while (inner != vImages.end())
                         {
+                            if (!*inner)
+                            {
+                                ++inner;
+                                continue;
+                            }
+                            if (m_memory_budget)
+                                m_memory_budget->release(*inner);
+                            page_spill_store::forget(*inner);
+                            page_compression_store::forget(*inner);
                             ::GlobalUnlock(*inner);
                             ::GlobalFree(*inner);
                             ++inner;
@@ -183,6 +438,7 @@ namespace dynarithmic
                         ++iter;
                     }
                     vect_image_handle_ptr->clear();
+                    m_store_pages.clear();
                 }
             }
 
@@ -0,0 +1,186 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_IMAGE_VIEW_HPP
+#define DTWAIN_IMAGE_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <dynarithmic/twain/imagehandler/dib_info.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Pixel layouts of acquired images.  Multi-byte pixels are in the DIB order (blue first).
+        enum class pixel_format : uint8_t
+        {
+            unknown,
+            bw1,        ///< 1 bit per pixel.  The palette gives the color of 0 and 1.
+            indexed4,   ///< 4 bits per pixel, indexes into the palette
+            gray8,      ///< 8 bits per pixel, 0 is black
+            indexed8,   ///< 8 bits per pixel, indexes into a palette that is not a gray ramp
+            bgr555,     ///< 16 bits per pixel, 5 bits for each of blue, green and red
+            bgr24,      ///< 24 bits per pixel
+            bgrx32      ///< 32 bits per pixel, the last byte unused
+        };
+
+        /// Returns the bits of each pixel in **format**
+        inline uint16_t get_bits_per_pixel(pixel_format format) noexcept
+        {
+            switch (format)
+            {
+                case pixel_format::bw1:      return 1;
+                case pixel_format::indexed4: return 4;
+                case pixel_format::gray8:
+                case pixel_format::indexed8: return 8;
+                case pixel_format::bgr555:   return 16;
+                case pixel_format::bgr24:    return 24;
+                case pixel_format::bgrx32:   return 32;
+                default:                     return 0;
+            }
+        }
+
+        /// A non-owning view of the pixels of an image: a pointer to the top row, the size, the signed distance between
+        /// rows, and the pixel format.
+        ///
+        /// Views are obtained without copying from a DIB (image_view::from_dib(), or image_handler::get_image_view(), which
+        /// returns a locked_image_view that keeps the DIB locked while it exists) or from a buffered transfer strip
+        /// (buffered_transfer_info::get_strip_view()).  Rows are always addressed from the top, so a bottom-up DIB simply
+        /// has a negative stride.  The view is only valid while the memory it refers to is.
+        struct image_view
+        {
+            const unsigned char* data = nullptr;    ///< first byte of the top row
+            int32_t width = 0;
+            int32_t height = 0;
+            int64_t stride = 0;                     ///< bytes from one row to the row below it; negative for bottom-up images
+            pixel_format format = pixel_format::unknown;
+            double x_resolution = 0;                ///< dots per inch, or 0 if not known
+            double y_resolution = 0;
+            const unsigned char* palette = nullptr; ///< RGBQUAD entries (blue, green, red, reserved), for bw1 and indexed formats
+            uint32_t palette_entries = 0;
+
+            bool empty() const noexcept { return !data || width <= 0 || height <= 0; }
+            explicit operator bool() const noexcept { return !empty(); }
+
+            uint16_t bits_per_pixel() const noexcept { return get_bits_per_pixel(format); }
+
+            /// Returns the bytes of pixel data in each row, not including any padding
+            size_t row_bytes() const noexcept { return (static_cast<size_t>(width) * bits_per_pixel() + 7) / 8; }
+
+            /// Returns the first byte of row **y**, where row 0 is the top row
+            const unsigned char* row(int32_t y) const noexcept { return data + y * stride; }
+
+            /// Returns a view of **count** rows starting at row **first** (clipped to the image)
+            image_view rows(int32_t first, int32_t count) const noexcept
+            {
+                image_view view = *this;
+                if (first < 0)
+                {
+                    count += first;
+                    first = 0;
+                }
+                if (first >= height || count <= 0)
+                {
+                    view.height = 0;
+                    return view;
+                }
+                view.data = row(first);
+                view.height = count < height - first ? count : height - first;
+                return view;
+            }
+
+            /// Returns a view of the rows at **data**, which are laid out top row first, **stride** bytes apart
+            static image_view from_rows(const void* data, int32_t width, int32_t height, int64_t stride, pixel_format format,
+                                        double x_resolution = 0, double y_resolution = 0) noexcept
+            {
+                image_view view;
+                view.data = static_cast<const unsigned char*>(data);
+                view.width = width;
+                view.height = height;
+                view.stride = stride;
+                view.format = format;
+                view.x_resolution = x_resolution;
+                view.y_resolution = y_resolution;
+                return view;
+            }
+
+            /// Returns a view of the DIB at **dib**, which has **size** bytes.
+            /// @returns an empty view if **dib** is not an uncompressed DIB of a supported format.
+            static image_view from_dib(const void* dib, size_t size) noexcept
+            {
+                image_view view;
+                dib_info info;
+                if (!info.parse(dib, size))
+                    return view;
+                const unsigned char* p = static_cast<const unsigned char*>(dib);
+                view.format = get_format(info, p + info.palette_offset);
+                if (view.format == pixel_format::unknown)
+                    return view;
+                const unsigned char* pixels = p + info.header_size;
+                view.data = info.is_bottom_up ? pixels + static_cast<size_t>(info.height - 1) * info.row_bytes : pixels;
+                view.width = info.width;
+                view.height = info.height;
+                view.stride = info.get_stride();
+                view.x_resolution = info.x_resolution;
+                view.y_resolution = info.y_resolution;
+                if (info.palette_entries && info.bits_per_pixel <= 8)
+                {
+                    view.palette = p + info.palette_offset;
+                    view.palette_entries = info.palette_entries;
+                }
+                return view;
+            }
+
+            private:
+                static pixel_format get_format(const dib_info& info, const unsigned char* palette) noexcept
+                {
+                    switch (info.bits_per_pixel)
+                    {
+                        case 1:
+                            return pixel_format::bw1;
+                        case 4:
+                            return pixel_format::indexed4;
+                        case 8:
+                        {
+                            // an 8-bit DIB is gray if its palette is the ramp 0, 1, ... 255
+                            if (info.palette_entries != 256)
+                                return pixel_format::indexed8;
+                            for (uint32_t i = 0; i < 256; ++i, palette += 4)
+                            {
+                                if (palette[0] != i || palette[1] != i || palette[2] != i)
+                                    return pixel_format::indexed8;
+                            }
+                            return pixel_format::gray8;
+                        }
+                        case 16:
+                            return info.compression == 0 ? pixel_format::bgr555 : pixel_format::unknown;
+                        case 24:
+                            return pixel_format::bgr24;
+                        case 32:
+                            return pixel_format::bgrx32;
+                        default:
+                            return pixel_format::unknown;
+                    }
+                }
+        };
+    }
+}
+#endif
@@ -0,0 +1,334 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_MAPPED_PAGE_STORE_HPP
+#define DTWAIN_MAPPED_PAGE_STORE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <dtwain.h>
+#include <dynarithmic/twain/imagehandler/dib_info.hpp>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/types/twain_mapped_file.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Stores acquired pages (DIBs) in a single memory-mapped file, with an index of each page's position and format.
+        ///
+        /// Each page is appended as a record: a fixed-size header describing the page, followed by the DIB.  A record is
+        /// marked as complete only after the DIB has been written, so a file left behind by a process that ended
+        /// unexpectedly can be reopened with open(), and contains every page that was completely written.  Other processes
+        /// can open the same file with open_read_only() and read the pages in place, while the writer keeps appending.
+        ///
+        /// File layout (all values little-endian):
+        /// <pre>
+        ///   file_header    "DTWPAGES", version
+        ///   record_header  page 1, followed by its DIB
+        ///   record_header  page 2, followed by its DIB
+        ///   ...
+        /// </pre>
+        class mapped_page_store
+        {
+            public:
+                struct page_entry
+                {
+                    uint32_t acquisition = 0;   ///< 0-based acquisition number
+                    uint32_t page = 0;          ///< 0-based page number within the acquisition
+                    uint64_t data_offset = 0;   ///< offset of the DIB in the file
+                    uint64_t data_size = 0;     ///< size of the DIB in bytes
+                    dib_info format;            ///< layout of the DIB
+                };
+
+                /// A page's DIB, in place in the mapped file
+                struct page_data
+                {
+                    const unsigned char* dib = nullptr;
+                    size_t size = 0;
+                    const page_entry* entry = nullptr;
+
+                    /// Returns the first byte of the pixel rows (the bottom row for bottom-up DIBs)
+                    const unsigned char* get_pixels() const noexcept { return dib ? dib + entry->format.header_size : nullptr; }
+                    explicit operator bool() const noexcept { return dib != nullptr; }
+
+                    /// Returns a view of the page's pixels, in place in the mapped file
+                    image_view get_view() const noexcept { return image_view::from_dib(dib, size); }
+                };
+
+            private:
+                struct file_header
+                {
+                    char magic[8];
+                    uint32_t version;
+                    uint32_t reserved;
+                };
+
+                struct record_header
+                {
+                    uint32_t magic;
+                    uint32_t committed;
+                    uint64_t record_size;       // header + DIB + padding to 8 bytes
+                    uint32_t acquisition;
+                    uint32_t page;
+                    uint64_t data_size;
+                };
+
+                static constexpr uint32_t record_magic = 0x45474150;   // "PAGE"
+                static constexpr uint32_t file_version = 1;
+
+                mutable std::mutex m_mutex;
+                twain_mapped_file m_file;
+                std::vector<page_entry> m_index;
+
+                static file_header make_file_header()
+                {
+                    file_header fh = {};
+                    std::memcpy(fh.magic, "DTWPAGES", 8);
+                    fh.version = file_version;
+                    return fh;
+                }
+
+                // rebuilds the index from the file, and discards an incomplete record at the end
+                bool scan()
+                {
+                    file_header fh;
+                    const file_header expected = make_file_header();
+                    if (!m_file.read(0, &fh, sizeof fh) || std::memcmp(fh.magic, expected.magic, 8) != 0 || fh.version != file_version)
+                        return false;
+                    uint64_t offset = sizeof(file_header);
+                    record_header rh;
+                    while (m_file.read(offset, &rh, sizeof rh) && rh.magic == record_magic && rh.committed == 1 &&
+                           rh.record_size >= sizeof rh + rh.data_size && offset + rh.record_size <= m_file.size())
+                    {
+                        page_entry entry;
+                        entry.acquisition = rh.acquisition;
+                        entry.page = rh.page;
+                        entry.data_offset = offset + sizeof rh;
+                        entry.data_size = rh.data_size;
+                        entry.format.parse(m_file.data() + entry.data_offset, static_cast<size_t>(entry.data_size));
+                        m_index.push_back(entry);
+                        offset += rh.record_size;
+                    }
+                    m_file.truncate(offset);
+                    return true;
+                }
+
+            public:
+                mapped_page_store() = default;
+                mapped_page_store(const mapped_page_store&) = delete;
+                mapped_page_store& operator=(const mapped_page_store&) = delete;
+
+                /// Creates a new, empty store at **path**.  An existing file is replaced.
+                bool create(const std::string& path)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_index.clear();
+                    if (!m_file.open(path, true, false))
+                        return false;
+                    const file_header fh = make_file_header();
+                    return m_file.append(&fh, sizeof fh) != twain_mapped_file::npos;
+                }
+
+                /// Opens an existing store to add more pages, and reads its index.  An incomplete record at the end of the file
+                /// is discarded.
+                /// @returns **false** if the file does not exist or is not a page store.
+                /// @note Only one process may open a store for writing.  Use open_read_only() to read a store that another
+                /// process is writing.
+                bool open(const std::string& path)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_index.clear();
+                    if (!m_file.open(path, false, false))
+                        return false;
+                    if (!scan())
+                    {
+                        m_file.close();
+                        return false;
+                    }
+                    return true;
+                }
+
+                /// Opens an existing store for reading only, and reads the index of the pages completely written so far.
+                ///
+                /// The file is neither resized nor truncated, so the store can be read while another process is adding
+                /// pages to it.  Pages added after the store was opened are not visible until it is opened again, and
+                /// add_page() fails.
+                /// @returns **false** if the file does not exist or is not a page store.
+                bool open_read_only(const std::string& path)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_index.clear();
+                    if (!m_file.open_read_only(path))
+                        return false;
+                    if (!scan())
+                    {
+                        m_file.close();
+                        return false;
+                    }
+                    return true;
+                }
+
+                /// Writes any pending changes to disk, and closes the file
+                void close()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_file.close();
+                    m_index.clear();
+                }
+
+                bool is_open() const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_file.is_open();
+                }
+
+                /// Appends the DIB at **dib** (**size** bytes) as page **page** of acquisition **acquisition**.
+                /// @returns the index of the page in the store, or -1 if the page could not be written.
+                int64_t add_page(const void* dib, size_t size, uint32_t acquisition, uint32_t page)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_file.is_open() || m_file.is_read_only() || !dib)
+                        return -1;
+                    record_header rh = {};
+                    rh.magic = record_magic;
+                    rh.committed = 0;
+                    rh.record_size = (sizeof rh + size + 7) & ~static_cast<uint64_t>(7);
+                    rh.acquisition = acquisition;
+                    rh.page = page;
+                    rh.data_size = size;
+
+                    const uint64_t offset = m_file.append(&rh, sizeof rh);
+                    if (offset == twain_mapped_file::npos || m_file.append(dib, size) == twain_mapped_file::npos)
+                    {
+                        if (offset != twain_mapped_file::npos)
+                            m_file.truncate(offset);
+                        return -1;
+                    }
+                    static const unsigned char padding[8] = {};
+                    m_file.append(padding, static_cast<size_t>(rh.record_size - sizeof rh - size));
+
+                    // the record only becomes visible once the DIB is completely written
+                    rh.committed = 1;
+                    m_file.write(offset, &rh, sizeof rh);
+
+                    page_entry entry;
+                    entry.acquisition = acquisition;
+                    entry.page = page;
+                    entry.data_offset = offset + sizeof rh;
+                    entry.data_size = size;
+                    entry.format.parse(dib, size);
+                    m_index.push_back(entry);
+                    return static_cast<int64_t>(m_index.size() - 1);
+                }
+
+                /// Appends the DIB held in the global memory handle **hDib**
+                int64_t add_page(HANDLE hDib, uint32_t acquisition, uint32_t page)
+                {
+                    #ifdef _WIN32
+                    if (!hDib)
+                        return -1;
+                    const void* p = ::GlobalLock(hDib);
+                    if (!p)
+                        return -1;
+                    const auto index = add_page(p, static_cast<size_t>(::GlobalSize(hDib)), acquisition, page);
+                    ::GlobalUnlock(hDib);
+                    return index;
+                    #else
+                    (void)hDib; (void)acquisition; (void)page;
+                    return -1;
+                    #endif
+                }
+
+                /// Returns a copy of the index of the stored pages
+                std::vector<page_entry> get_index() const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_index;
+                }
+
+                size_t get_page_count() const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_index.size();
+                }
+
+                /// Returns the DIB of page **index** in place in the mapped file.
+                /// @note The returned pointers are only valid until the next page is added, since adding a page can remap the file.
+                page_data get_page(size_t index) const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    page_data pd;
+                    if (index >= m_index.size())
+                        return pd;
+                    pd.entry = &m_index[index];
+                    pd.dib = m_file.data() + pd.entry->data_offset;
+                    pd.size = static_cast<size_t>(pd.entry->data_size);
+                    return pd;
+                }
+
+                /// Returns the index of page **page** of acquisition **acquisition**, or -1 if there is no such page
+                int64_t find_page(uint32_t acquisition, uint32_t page) const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (size_t i = 0; i < m_index.size(); ++i)
+                    {
+                        if (m_index[i].acquisition == acquisition && m_index[i].page == page)
+                            return static_cast<int64_t>(i);
+                    }
+                    return -1;
+                }
+
+                /// Copies page **index** into a new global memory DIB, owned by the caller
+                HANDLE copy_to_handle(size_t index) const
+                {
+                    #ifdef _WIN32
+                    const page_data pd = get_page(index);
+                    if (!pd)
+                        return nullptr;
+                    HANDLE h = ::GlobalAlloc(GHND, pd.size);
+                    if (!h)
+                        return nullptr;
+                    void* p = ::GlobalLock(h);
+                    std::memcpy(p, pd.dib, pd.size);
+                    ::GlobalUnlock(h);
+                    return h;
+                    #else
+                    (void)index;
+                    return nullptr;
+                    #endif
+                }
+
+                /// Writes the mapped pages to disk
+                bool flush()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_file.flush();
+                }
+
+                const std::string& get_path() const noexcept { return m_file.get_path(); }
+        };
+    }
+}
+#endif
@@ -0,0 +1,284 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_PAGE_CODEC_HPP
+#define DTWAIN_PAGE_CODEC_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <dynarithmic/twain/imagehandler/dib_info.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Fast lossless codecs for pages held in memory.
+        ///
+        /// run_length is PackBits, which suits 1-bit pages (long runs of white and black bytes).  lz is the LZ4 block
+        /// format, which suits gray and color pages.  Both favor speed over ratio, since pages are compressed as they
+        /// arrive and decompressed whenever they are accessed.
+        struct page_codec
+        {
+            enum class codec_type : uint8_t
+            {
+                none,
+                run_length,
+                lz
+            };
+
+            /// Returns the codec to use for the DIB **dib** of **size** bytes
+            static codec_type choose(const void* dib, size_t size)
+            {
+                dib_info info;
+                info.parse(dib, size);
+                return info.bits_per_pixel == 1 ? codec_type::run_length : codec_type::lz;
+            }
+
+            /// Compresses **size** bytes at **src**.
+            /// @returns the compressed bytes, or an empty vector if **codec** is codec_type::none.
+            static std::vector<unsigned char> compress(codec_type codec, const unsigned char* src, size_t size)
+            {
+                switch (codec)
+                {
+                    case codec_type::run_length:
+                        return compress_run_length(src, size);
+                    case codec_type::lz:
+                        return compress_lz(src, size);
+                    default:
+                        return std::vector<unsigned char>();
+                }
+            }
+
+            /// Decompresses **size** bytes at **src** into **dest**, which has room for exactly **dest_size** bytes.
+            /// @returns **true** if exactly **dest_size** bytes were decompressed.
+            static bool decompress(codec_type codec, const unsigned char* src, size_t size, unsigned char* dest, size_t dest_size)
+            {
+                switch (codec)
+                {
+                    case codec_type::run_length:
+                        return decompress_run_length(src, size, dest, dest_size);
+                    case codec_type::lz:
+                        return decompress_lz(src, size, dest, dest_size);
+                    default:
+                        return false;
+                }
+            }
+
+            private:
+                // PackBits: a control byte n in [0, 127] is followed by n + 1 literal bytes; n in [-127, -1] is
+                // followed by one byte repeated 1 - n times.
+                static std::vector<unsigned char> compress_run_length(const unsigned char* src, size_t size)
+                {
+                    std::vector<unsigned char> out;
+                    out.reserve(size / 8 + 16);
+                    size_t i = 0;
+                    while (i < size)
+                    {
+                        size_t run = 1;
+                        while (i + run < size && run < 128 && src[i + run] == src[i])
+                            ++run;
+                        if (run >= 2)
+                        {
+                            out.push_back(static_cast<unsigned char>(257 - run));
+                            out.push_back(src[i]);
+                            i += run;
+                            continue;
+                        }
+                        // literals continue until a run of at least 3 bytes starts
+                        size_t count = 1;
+                        while (i + count < size && count < 128 &&
+                               !(i + count + 2 < size && src[i + count] == src[i + count + 1] && src[i + count] == src[i + count + 2]))
+                            ++count;
+                        out.push_back(static_cast<unsigned char>(count - 1));
+                        out.insert(out.end(), src + i, src + i + count);
+                        i += count;
+                    }
+                    return out;
+                }
+
+                static bool decompress_run_length(const unsigned char* src, size_t size, unsigned char* dest, size_t dest_size)
+                {
+                    size_t in = 0;
+                    size_t out = 0;
+                    while (in < size)
+                    {
+                        const unsigned char control = src[in++];
+                        if (control < 128)
+                        {
+                            const size_t count = static_cast<size_t>(control) + 1;
+                            if (in + count > size || out + count > dest_size)
+                                return false;
+                            std::memcpy(dest + out, src + in, count);
+                            in += count;
+                            out += count;
+                        }
+                        else if (control > 128)
+                        {
+                            const size_t count = 257 - static_cast<size_t>(control);
+                            if (in >= size || out + count > dest_size)
+                                return false;
+                            std::memset(dest + out, src[in++], count);
+                            out += count;
+                        }
+                    }
+                    return out == dest_size;
+                }
+
+                static uint32_t read32(const unsigned char* p)
+                {
+                    uint32_t value;
+                    std::memcpy(&value, p, sizeof value);
+                    return value;
+                }
+
+                static void write_length(std::vector<unsigned char>& out, size_t length)
+                {
+                    for (; length >= 255; length -= 255)
+                        out.push_back(255);
+                    out.push_back(static_cast<unsigned char>(length));
+                }
+
+                static void write_sequence(std::vector<unsigned char>& out, const unsigned char* literals, size_t literal_count,
+                                           size_t offset, size_t match_length)
+                {
+                    const size_t match_code = match_length ? match_length - 4 : 0;
+                    out.push_back(static_cast<unsigned char>(((std::min)(literal_count, size_t(15)) << 4) | (std::min)(match_code, size_t(15))));
+                    if (literal_count >= 15)
+                        write_length(out, literal_count - 15);
+                    out.insert(out.end(), literals, literals + literal_count);
+                    if (!match_length)
+                        return;
+                    out.push_back(static_cast<unsigned char>(offset & 0xFF));
+                    out.push_back(static_cast<unsigned char>(offset >> 8));
+                    if (match_code >= 15)
+                        write_length(out, match_code - 15);
+                }
+
+                // LZ4 block format.  The last match starts at least 12 bytes before the end, and the last 5 bytes are
+                // always literals, as the format requires.
+                static std::vector<unsigned char> compress_lz(const unsigned char* src, size_t size)
+                {
+                    constexpr int hash_bits = 14;
+                    constexpr size_t min_match = 4;
+                    constexpr size_t max_offset = 65535;
+                    std::vector<unsigned char> out;
+                    out.reserve(size / 2 + 16);
+                    size_t anchor = 0;
+                    if (size > 12)
+                    {
+                        // positions are stored plus one, so that 0 means "no entry"
+                        std::vector<uint32_t> table(size_t(1) << hash_bits, 0);
+                        const size_t match_limit = size - 12;
+                        const size_t extend_limit = size - 5;
+                        size_t pos = 0;
+                        while (pos < match_limit)
+                        {
+                            const uint32_t sequence = read32(src + pos);
+                            const uint32_t hash = (sequence * 2654435761u) >> (32 - hash_bits);
+                            const size_t candidate = table[hash];
+                            table[hash] = static_cast<uint32_t>(pos + 1);
+                            if (candidate && pos - (candidate - 1) <= max_offset && read32(src + candidate - 1) == sequence)
+                            {
+                                size_t match = candidate - 1;
+                                // extend the match backwards over pending literals
+                                while (pos > anchor && match > 0 && src[pos - 1] == src[match - 1])
+                                {
+                                    --pos;
+                                    --match;
+                                }
+                                size_t length = min_match;
+                                while (pos + length < extend_limit && src[match + length] == src[pos + length])
+                                    ++length;
+                                write_sequence(out, src + anchor, pos - anchor, pos - match, length);
+                                pos += length;
+                                anchor = pos;
+                            }
+                            else
+                            {
+                                // skip faster through data that does not compress
+                                pos += 1 + ((pos - anchor) >> 6);
+                            }
+                        }
+                    }
+                    write_sequence(out, src + anchor, size - anchor, 0, 0);
+                    return out;
+                }
+
+                static bool read_length(const unsigned char* src, size_t size, size_t& in, size_t& length)
+                {
+                    unsigned char b;
+                    do
+                    {
+                        if (in >= size)
+                            return false;
+                        b = src[in++];
+                        length += b;
+                    } while (b == 255);
+                    return true;
+                }
+
+                static bool decompress_lz(const unsigned char* src, size_t size, unsigned char* dest, size_t dest_size)
+                {
+                    size_t in = 0;
+                    size_t out = 0;
+                    while (in < size)
+                    {
+                        const unsigned char token = src[in++];
+                        size_t literal_count = token >> 4;
+                        if (literal_count == 15 && !read_length(src, size, in, literal_count))
+                            return false;
+                        if (in + literal_count > size || out + literal_count > dest_size)
+                            return false;
+                        std::memcpy(dest + out, src + in, literal_count);
+                        in += literal_count;
+                        out += literal_count;
+                        if (in == size)
+                            break;  // the last sequence has no match
+
+                        if (in + 2 > size)
+                            return false;
+                        const size_t offset = src[in] | (static_cast<size_t>(src[in + 1]) << 8);
+                        in += 2;
+                        size_t length = token & 0x0F;
+                        if (length == 15 && !read_length(src, size, in, length))
+                            return false;
+                        length += 4;
+                        if (offset == 0 || offset > out || out + length > dest_size)
+                            return false;
+                        // matches may overlap the bytes they produce, so copy forwards one byte at a time
+                        const unsigned char* match = dest + out - offset;
+                        if (offset >= length)
+                            std::memcpy(dest + out, match, length);
+                        else
+                        {
+                            for (size_t i = 0; i < length; ++i)
+                                dest[out + i] = match[i];
+                        }
+                        out += length;
+                    }
+                    return out == dest_size;
+                }
+        };
+    }
+}
+#endif
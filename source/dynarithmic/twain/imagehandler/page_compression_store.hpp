@@ -0,0 +1,352 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_PAGE_COMPRESSION_STORE_HPP
+#define DTWAIN_PAGE_COMPRESSION_STORE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <dtwain.h>
+#include <dynarithmic/twain/imagehandler/page_codec.hpp>
+#include <dynarithmic/twain/source/memory_budget.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        struct page_compression_stats
+        {
+            size_t compressed_pages = 0;        ///< pages currently held compressed
+            size_t pending_pages = 0;           ///< pages waiting to be compressed
+            uint64_t original_bytes = 0;        ///< uncompressed size of the pages currently held compressed
+            uint64_t compressed_bytes = 0;      ///< compressed size of the pages currently held compressed
+            uint64_t compress_count = 0;        ///< number of times a page was compressed
+            uint64_t decompress_count = 0;      ///< number of times a page was decompressed on access
+            uint64_t skipped_count = 0;         ///< pages left uncompressed because they did not compress, or were accessed first
+        };
+
+        /// Compresses acquired pages (DIBs) held in memory on a background thread, and decompresses them when they are accessed.
+        ///
+        /// 1-bit pages are compressed with run-length encoding, and other pages with an LZ4-class codec (see page_codec).
+        /// As with page_spill_store, a compressed page keeps its HANDLE: the memory block is shrunk, and is reallocated and
+        /// decompressed when the page is accessed through ensure_resident() (which image_handler does for every page it returns).
+        ///
+        /// The memory of a page is replaced asynchronously, so only pages whose every access goes through ensure_resident()
+        /// may be added: image_handler adds the pages it owns (see image_handler::set_compression_store()).  A page is
+        /// compressed once, after it is added.  A page that has been accessed is not compressed again, since the caller
+        /// may be using its memory.
+        /// @note Compression is only done for Windows global memory handles.  On other platforms pages are never compressed.
+        class page_compression_store
+        {
+            struct compressed_page
+            {
+                page_codec::codec_type codec;
+                size_t original_size;
+                std::vector<unsigned char> data;
+                bool charged = false;   // the page was charged to the memory budget at its compressed size
+            };
+
+            struct registry_type
+            {
+                std::mutex mutex;
+                std::unordered_map<HANDLE, std::weak_ptr<page_compression_store>> stores;
+            };
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::weak_ptr<page_compression_store> m_self;
+            std::deque<HANDLE> m_queue;
+            std::unordered_set<HANDLE> m_pending;       // queued pages that have not been accessed
+            std::unordered_map<HANDLE, compressed_page> m_compressed;
+            HANDLE m_in_progress = nullptr;             // page whose memory the worker is reading
+            bool m_bStop = false;
+            page_compression_stats m_stats;
+            std::shared_ptr<memory_budget> m_memory_budget;
+            std::thread m_worker;
+
+            static registry_type& get_registry()
+            {
+                static registry_type registry;
+                return registry;
+            }
+
+            page_compression_store() = default;
+
+            // the worker reads a page without holding the lock, so callers that may change or free the page wait for it
+            void wait_for_worker_locked(std::unique_lock<std::mutex>& lock, HANDLE h)
+            {
+                m_cv.wait(lock, [&] { return m_in_progress != h; });
+            }
+
+            bool compress_page(HANDLE h, compressed_page& page)
+            {
+                #ifdef _WIN32
+                const unsigned char* p = static_cast<const unsigned char*>(::GlobalLock(h));
+                // fixed memory (where the HANDLE is the pointer) cannot keep its HANDLE when reallocated
+                if (!p || p == h)
+                {
+                    if (p)
+                        ::GlobalUnlock(h);
+                    return false;
+                }
+                page.original_size = static_cast<size_t>(::GlobalSize(h));
+                page.codec = page_codec::choose(p, page.original_size);
+                page.data = page_codec::compress(page.codec, p, page.original_size);
+                ::GlobalUnlock(h);
+                // not worth holding if it saves less than an eighth
+                return page.data.size() < page.original_size - page.original_size / 8;
+                #else
+                (void)h; (void)page;
+                return false;
+                #endif
+            }
+
+            void worker_proc()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                while (true)
+                {
+                    m_cv.wait(lock, [&] { return m_bStop || !m_queue.empty(); });
+                    if (m_bStop)
+                        return;
+                    HANDLE h = m_queue.front();
+                    m_queue.pop_front();
+                    if (!m_pending.count(h))
+                        continue;
+
+                    m_in_progress = h;
+                    lock.unlock();
+                    compressed_page page;
+                    const bool compressed = compress_page(h, page);
+                    lock.lock();
+                    m_in_progress = nullptr;
+                    finish_page_locked(h, compressed, page);
+                    m_cv.notify_all();
+                }
+            }
+
+            void finish_page_locked(HANDLE h, bool compressed, compressed_page& page)
+            {
+                // the page may have been accessed or forgotten while it was being compressed
+                if (!m_pending.erase(h))
+                    return;
+                #ifdef _WIN32
+                if (compressed && ::GlobalReAlloc(h, 1, GMEM_MOVEABLE) == h)
+                {
+                    // the page now takes the memory of its compressed data (the key of which does not move with the vector)
+                    page.charged = m_memory_budget && m_memory_budget->release(h);
+                    if (page.charged)
+                        m_memory_budget->charge(page.data.data(), page.data.size());
+                    m_stats.original_bytes += page.original_size;
+                    m_stats.compressed_bytes += page.data.size();
+                    ++m_stats.compress_count;
+                    m_compressed[h] = std::move(page);
+                    return;
+                }
+                #else
+                (void)compressed; (void)page;
+                #endif
+                ++m_stats.skipped_count;
+            }
+
+            bool decompress_locked(HANDLE h)
+            {
+                #ifdef _WIN32
+                auto iter = m_compressed.find(h);
+                if (iter == m_compressed.end())
+                    return false;
+                const compressed_page& page = iter->second;
+                if (::GlobalReAlloc(h, page.original_size, GMEM_MOVEABLE) != h)
+                    return false;
+                unsigned char* p = static_cast<unsigned char*>(::GlobalLock(h));
+                if (!p)
+                    return false;
+                page_codec::decompress(page.codec, page.data.data(), page.data.size(), p, page.original_size);
+                ::GlobalUnlock(h);
+                if (page.charged)
+                {
+                    m_memory_budget->release(page.data.data());
+                    m_memory_budget->charge(h, page.original_size);
+                }
+                m_stats.original_bytes -= page.original_size;
+                m_stats.compressed_bytes -= page.data.size();
+                ++m_stats.decompress_count;
+                m_compressed.erase(iter);
+                return true;
+                #else
+                (void)h;
+                return false;
+                #endif
+            }
+
+            // the page is about to be used: it is decompressed, and is not compressed again.  Returns **false** if the
+            // page is compressed and could not be decompressed.
+            bool make_resident(HANDLE h)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_pending.erase(h))
+                    ++m_stats.skipped_count;
+                wait_for_worker_locked(lock, h);
+                const bool resident = !m_compressed.count(h) || decompress_locked(h);
+                m_cv.notify_all();
+                return resident;
+            }
+
+        public:
+            page_compression_store(const page_compression_store&) = delete;
+            page_compression_store& operator=(const page_compression_store&) = delete;
+
+            ~page_compression_store()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_bStop = true;
+                }
+                m_cv.notify_all();
+                if (m_worker.joinable())
+                    m_worker.join();
+
+                auto& registry = get_registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (HANDLE h : m_pending)
+                    registry.stores.erase(h);
+                for (auto& pr : m_compressed)
+                    registry.stores.erase(pr.first);
+            }
+
+            /// Creates a store, and starts its compression thread
+            static std::shared_ptr<page_compression_store> create()
+            {
+                std::shared_ptr<page_compression_store> store(new page_compression_store);
+                store->m_self = store;
+                store->m_worker = std::thread([raw = store.get()] { raw->worker_proc(); });
+                return store;
+            }
+
+            /// Sets the memory budget that a page is charged to at its compressed size while it is compressed, instead of
+            /// its full size.  Must be set before pages are added.
+            void set_memory_budget(std::shared_ptr<memory_budget> budget)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_memory_budget = std::move(budget);
+            }
+
+            /// Queues the page **h** to be compressed on the compression thread.  The page must only be accessed after a
+            /// call to ensure_resident(), and must not be held by DTWAIN.
+            void add_page(HANDLE h)
+            {
+                if (!h)
+                    return;
+                {
+                    auto& registry = get_registry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    registry.stores[h] = m_self;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_compressed.count(h) || !m_pending.insert(h).second)
+                        return;
+                    m_queue.push_back(h);
+                }
+                m_cv.notify_all();
+            }
+
+            /// Returns the store that tracks the page **h**, or **nullptr** if the page is not tracked by any store
+            static std::shared_ptr<page_compression_store> find_store(HANDLE h)
+            {
+                auto& registry = get_registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                auto iter = registry.stores.find(h);
+                return iter == registry.stores.end() ? nullptr : iter->second.lock();
+            }
+
+            /// Makes sure that the page **h** is uncompressed, and will not be compressed.
+            /// @returns **h**, or **nullptr** if the page is compressed and could not be decompressed (for example, if
+            /// there is not enough memory).  The page is then still held compressed, and can be decompressed later.
+            static HANDLE ensure_resident(HANDLE h)
+            {
+                auto store = find_store(h);
+                return !store || store->make_resident(h) ? h : nullptr;
+            }
+
+            /// Stops tracking the page **h**.  Must be called before a tracked page is freed.
+            /// @note A compressed page is not decompressed, so the (shrunk) HANDLE can be freed immediately.
+            static void forget(HANDLE h)
+            {
+                std::shared_ptr<page_compression_store> store;
+                {
+                    auto& registry = get_registry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    auto iter = registry.stores.find(h);
+                    if (iter == registry.stores.end())
+                        return;
+                    store = iter->second.lock();
+                    registry.stores.erase(iter);
+                }
+                if (!store)
+                    return;
+                std::unique_lock<std::mutex> lock(store->m_mutex);
+                store->m_pending.erase(h);
+                store->wait_for_worker_locked(lock, h);
+                auto iter = store->m_compressed.find(h);
+                if (iter != store->m_compressed.end())
+                {
+                    if (iter->second.charged)
+                        store->m_memory_budget->release(iter->second.data.data());
+                    store->m_stats.original_bytes -= iter->second.original_size;
+                    store->m_stats.compressed_bytes -= iter->second.data.size();
+                    store->m_compressed.erase(iter);
+                }
+                store->m_cv.notify_all();
+            }
+
+            /// Returns **true** if the page **h** is currently held compressed
+            bool is_compressed(HANDLE h) const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_compressed.count(h) != 0;
+            }
+
+            /// Waits until every queued page has been compressed (or skipped)
+            void wait_idle()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [&] { return m_pending.empty() && m_in_progress == nullptr; });
+            }
+
+            page_compression_stats get_stats() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                page_compression_stats stats = m_stats;
+                stats.compressed_pages = m_compressed.size();
+                stats.pending_pages = m_pending.size();
+                return stats;
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,534 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_PAGE_DESKEW_HPP
+#define DTWAIN_PAGE_DESKEW_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/imagehandler/pixel_kernels.hpp>
+#include <dynarithmic/twain/imagehandler/thumbnail_generator.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// The skew of a page.  A positive angle means the text lines fall from left to right (the page is turned clockwise).
+        struct skew_estimate
+        {
+            double angle = 0;           ///< degrees
+            double resolution = 0;      ///< the smallest difference in angle the estimate can tell apart, in degrees
+            double confidence = 0;      ///< 0 (no line structure found) to 1 (sharp text lines)
+            bool valid = false;         ///< **false** if the page had too little ink to measure
+        };
+
+        /// Measures the skew of a page from projection profiles.
+        ///
+        /// The page is reduced to a thumbnail of at most 1024 x 1024 pixels, and the lower edge of each dark run is kept
+        /// as a point.  For each candidate angle the points are projected onto rows sheared by that angle; the angle at
+        /// which text lines collapse into the fewest, fullest rows (the largest sum of squared row counts) is the skew.
+        /// A coarse search over the whole range is refined around the best coarse angle.
+        class skew_estimator
+        {
+            public:
+                static constexpr double default_max_angle = 5.0;
+
+            private:
+                double m_max_angle = default_max_angle;
+                unsigned char m_ink_level = 128;
+                thumbnail_generator m_generator;
+                std::vector<int32_t> m_points;      // x, y pairs
+                std::vector<uint32_t> m_bins;
+
+                static constexpr size_t min_points = 100;
+
+                uint64_t score(double degrees, int32_t height, int32_t width)
+                {
+                    const double t = std::tan(degrees * 3.14159265358979323846 / 180.0);
+                    // rows are y - x * tan, in 16.16 fixed point, offset so that they are never negative
+                    const int64_t step = static_cast<int64_t>(std::llround(t * 65536.0));
+                    const int64_t offset = step > 0 ? step * width : 0;
+                    const size_t bins = static_cast<size_t>(height) + static_cast<size_t>(std::ceil(std::fabs(t) * width)) + 2;
+                    m_bins.assign(bins, 0);
+                    for (size_t i = 0; i < m_points.size(); i += 2)
+                    {
+                        const int64_t row = (static_cast<int64_t>(m_points[i + 1]) << 16) - step * m_points[i] + offset;
+                        ++m_bins[static_cast<size_t>(row >> 16)];
+                    }
+                    uint64_t result = 0;
+                    for (uint32_t count : m_bins)
+                        result += static_cast<uint64_t>(count) * count;
+                    return result;
+                }
+
+            public:
+                skew_estimator()
+                {
+                    m_generator.set_max_size(1024, 1024);
+                }
+
+                /// Sets the largest skew (in degrees, either way) that is searched for
+                skew_estimator& set_max_angle(double degrees) noexcept { m_max_angle = (std::min)((std::max)(degrees, 0.1), 45.0); return *this; }
+
+                /// Sets the lightness below which a pixel is ink
+                skew_estimator& set_ink_level(unsigned char level) noexcept { m_ink_level = level; return *this; }
+
+                /// Returns the skew of the image **view**
+                skew_estimate estimate(const image_view& view)
+                {
+                    skew_estimate result;
+                    const thumbnail thumb = m_generator.generate(view);
+                    if (thumb.empty() || thumb.height < 2)
+                        return result;
+                    const image_view small = thumb.get_view();
+                    const int channels = small.format == pixel_format::gray8 ? 1 : 3;
+
+                    // the lower edges of dark runs: ink pixels whose lower neighbor is not ink
+                    std::vector<unsigned char> ink(static_cast<size_t>(small.width) * small.height);
+                    for (int32_t y = 0; y < small.height; ++y)
+                    {
+                        const unsigned char* row = small.row(y);
+                        for (int32_t x = 0; x < small.width; ++x)
+                        {
+                            const unsigned char* p = row + x * channels;
+                            const unsigned lightness = channels == 1 ? p[0] : (p[0] * 29u + p[1] * 150u + p[2] * 77u) >> 8;
+                            ink[static_cast<size_t>(y) * small.width + x] = lightness < m_ink_level;
+                        }
+                    }
+                    m_points.clear();
+                    for (int32_t y = 0; y + 1 < small.height; ++y)
+                    {
+                        const unsigned char* row = &ink[static_cast<size_t>(y) * small.width];
+                        for (int32_t x = 0; x < small.width; ++x)
+                        {
+                            if (row[x] && !row[x + small.width])
+                            {
+                                m_points.push_back(x);
+                                m_points.push_back(y);
+                            }
+                        }
+                    }
+                    if (m_points.size() / 2 < min_points)
+                        return result;
+
+                    // one row of difference across the thumbnail is the finest angle that shows in the profiles
+                    result.resolution = std::atan(1.0 / small.width) * 180.0 / 3.14159265358979323846;
+                    const double coarse_step = (std::max)(result.resolution * 4, m_max_angle / 50);
+                    std::vector<uint64_t> coarse;
+                    double best_angle = 0;
+                    uint64_t best = 0;
+                    const int coarse_steps = static_cast<int>(m_max_angle / coarse_step);
+                    for (int i = -coarse_steps; i <= coarse_steps; ++i)
+                    {
+                        const double angle = i * coarse_step;
+                        coarse.push_back(score(angle, small.height, small.width));
+                        if (coarse.back() > best)
+                        {
+                            best = coarse.back();
+                            best_angle = angle;
+                        }
+                    }
+                    const double fine_step = coarse_step / 8;
+                    const double center = best_angle;
+                    for (int i = -7; i <= 7; ++i)
+                    {
+                        const double angle = center + i * fine_step;
+                        const uint64_t s = score(angle, small.height, small.width);
+                        if (s > best)
+                        {
+                            best = s;
+                            best_angle = angle;
+                        }
+                    }
+                    std::nth_element(coarse.begin(), coarse.begin() + coarse.size() / 2, coarse.end());
+                    result.confidence = best ? 1.0 - static_cast<double>(coarse[coarse.size() / 2]) / static_cast<double>(best) : 0;
+                    result.angle = best_angle;
+                    result.valid = true;
+                    return result;
+                }
+        };
+
+        /// Rotates pages to remove skew.
+        ///
+        /// Each output pixel is read from the rotated position in the source, using 16.16 fixed-point coordinates that
+        /// step along the output rows.  The output is produced in tiles of 32 rows by 256 pixels, so the source rows a
+        /// tile reads stay in the cache for small angles.  Gray and color pixels are interpolated bilinearly with SSE2
+        /// (gray pixels eight at a time); bitonal and palette pixels take the nearest source pixel.  Areas rotated in from
+        /// outside the page are filled with the lightest color.
+        struct page_rotator
+        {
+            static constexpr int32_t tile_width = 256;
+            static constexpr int32_t tile_height = 32;
+
+            /// Writes **src** with a skew of **degrees** removed to **dest**, which has the same size and format as **src**,
+            /// and whose top row is at **dest_top** with rows **dest_stride** bytes apart.  **dest** must not overlap **src**.
+            /// @returns **false** if the format is not supported.
+            static bool remove_skew(const image_view& src, unsigned char* dest_top, int64_t dest_stride, double degrees) noexcept
+            {
+                if (src.empty() || src.format == pixel_format::unknown)
+                    return false;
+                const double radians = degrees * 3.14159265358979323846 / 180.0;
+                const double cs = std::cos(radians), sn = std::sin(radians);
+                const double cx = (src.width - 1) / 2.0, cy = (src.height - 1) / 2.0;
+                // the source position of output pixel (x, y) is (cx + dx * cos - dy * sin, cy + dx * sin + dy * cos)
+                const int64_t step_x = std::llround(cs * 65536.0);      // per output pixel to the right
+                const int64_t step_y = std::llround(sn * 65536.0);
+                const uint32_t background = lightest(src);
+                const int64_t start_x = std::llround((cx - cx * cs + cy * sn) * 65536.0);  // source position of output (0, 0)
+                const int64_t start_y = std::llround((cy - cx * sn - cy * cs) * 65536.0);
+                switch (src.format)
+                {
+                    case pixel_format::bw1:      rotate<pixel_format::bw1>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::indexed4: rotate<pixel_format::indexed4>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::gray8:    rotate<pixel_format::gray8>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::indexed8: rotate<pixel_format::indexed8>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::bgr555:   rotate<pixel_format::bgr555>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::bgr24:    rotate<pixel_format::bgr24>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    case pixel_format::bgrx32:   rotate<pixel_format::bgrx32>(src, dest_top, dest_stride, start_x, start_y, step_x, step_y, background); break;
+                    default: return false;
+                }
+                return true;
+            }
+
+            private:
+                template <pixel_format F>
+                static void rotate(const image_view& src, unsigned char* dest_top, int64_t dest_stride, int64_t start_x, int64_t start_y,
+                                   int64_t step_x, int64_t step_y, uint32_t background) noexcept
+                {
+                    for (int32_t ty = 0; ty < src.height; ty += tile_height)
+                    {
+                        const int32_t ty_end = (std::min)(ty + tile_height, src.height);
+                        for (int32_t tx = 0; tx < src.width; tx += tile_width)
+                        {
+                            const int32_t tx_end = (std::min)(tx + tile_width, src.width);
+                            for (int32_t y = ty; y < ty_end; ++y)
+                            {
+                                // moving down one output row moves the source position by (-sin, cos)
+                                int64_t sx = start_x + tx * step_x - y * step_y;
+                                int64_t sy = start_y + tx * step_y + y * step_x;
+                                unsigned char* out = dest_top + y * dest_stride;
+                                // the pixels whose source lies inside the page form one span, which needs no bounds checks
+                                int32_t x = tx;
+                                for (; x < tx_end && !is_inside<F>(src, sx, sy); ++x, sx += step_x, sy += step_y)
+                                    put_pixel<F>(out, x, sample<F>(src, sx, sy, background));
+                                int32_t inside_end = tx_end;
+                                while (inside_end > x && !is_inside<F>(src, sx + (inside_end - 1 - x) * step_x, sy + (inside_end - 1 - x) * step_y))
+                                    --inside_end;
+                                #ifdef DTWAIN_PIXEL_KERNELS_X86
+                                if (F == pixel_format::gray8)
+                                    gray_span_sse2(src, out, x, inside_end, sx, sy, step_x, step_y);
+                                #endif
+                                for (; x < inside_end; ++x, sx += step_x, sy += step_y)
+                                    put_pixel<F>(out, x, sample_inside<F>(src, sx, sy));
+                                for (; x < tx_end; ++x, sx += step_x, sy += step_y)
+                                    put_pixel<F>(out, x, sample<F>(src, sx, sy, background));
+                            }
+                        }
+                    }
+                }
+
+                // the pixel value (index or packed color) that is lightest, used for the background
+                static uint32_t lightest(const image_view& src) noexcept
+                {
+                    switch (src.format)
+                    {
+                        case pixel_format::gray8:  return 255;
+                        case pixel_format::bgr555: return 0x7FFF;
+                        case pixel_format::bgr24:
+                        case pixel_format::bgrx32: return 0xFFFFFF;
+                        default: break;
+                    }
+                    uint32_t best = 0, best_lightness = 0;
+                    for (uint32_t i = 0; src.palette && i < src.palette_entries; ++i)
+                    {
+                        const unsigned char* p = src.palette + i * 4;
+                        const uint32_t lightness = p[0] * 29u + p[1] * 150u + p[2] * 77u;
+                        if (lightness > best_lightness)
+                        {
+                            best_lightness = lightness;
+                            best = i;
+                        }
+                    }
+                    return src.palette ? best : 1;
+                }
+
+                template <pixel_format F>
+                static uint32_t get_pixel(const unsigned char* row, int32_t x) noexcept
+                {
+                    switch (F)
+                    {
+                        case pixel_format::bw1:      return (row[x >> 3] >> (7 - (x & 7))) & 1;
+                        case pixel_format::indexed4: return (row[x >> 1] >> ((x & 1) ? 0 : 4)) & 0x0F;
+                        case pixel_format::gray8:
+                        case pixel_format::indexed8: return row[x];
+                        case pixel_format::bgr555:   return row[2 * x] | (row[2 * x + 1] << 8);
+                        case pixel_format::bgr24:    return row[3 * x] | (row[3 * x + 1] << 8) | (row[3 * x + 2] << 16);
+                        case pixel_format::bgrx32:
+                        {
+                            uint32_t v;
+                            std::memcpy(&v, row + 4 * x, 4);
+                            return v;
+                        }
+                        default:                     return 0;
+                    }
+                }
+
+                template <pixel_format F>
+                static void put_pixel(unsigned char* row, int32_t x, uint32_t v) noexcept
+                {
+                    switch (F)
+                    {
+                        case pixel_format::bw1:
+                        {
+                            const unsigned char bit = static_cast<unsigned char>(0x80 >> (x & 7));
+                            row[x >> 3] = static_cast<unsigned char>(v ? (row[x >> 3] | bit) : (row[x >> 3] & ~bit));
+                        }
+                        break;
+                        case pixel_format::indexed4:
+                            row[x >> 1] = static_cast<unsigned char>((x & 1) ? ((row[x >> 1] & 0xF0) | v) : ((row[x >> 1] & 0x0F) | (v << 4)));
+                        break;
+                        case pixel_format::gray8:
+                        case pixel_format::indexed8:
+                            row[x] = static_cast<unsigned char>(v);
+                        break;
+                        case pixel_format::bgr555:
+                            row[2 * x] = static_cast<unsigned char>(v);
+                            row[2 * x + 1] = static_cast<unsigned char>(v >> 8);
+                        break;
+                        case pixel_format::bgr24:
+                            row[3 * x] = static_cast<unsigned char>(v);
+                            row[3 * x + 1] = static_cast<unsigned char>(v >> 8);
+                            row[3 * x + 2] = static_cast<unsigned char>(v >> 16);
+                        break;
+                        case pixel_format::bgrx32:
+                            std::memcpy(row + 4 * x, &v, 4);
+                        break;
+                        default:
+                        break;
+                    }
+                }
+
+                static constexpr bool interpolates(pixel_format format) noexcept
+                {
+                    return format == pixel_format::gray8 || format == pixel_format::bgr24 || format == pixel_format::bgrx32;
+                }
+
+                // blends four pixels of up to four 8-bit channels; fx and fy are 0 to 128
+                static uint32_t blend(uint32_t p00, uint32_t p01, uint32_t p10, uint32_t p11, uint32_t fx, uint32_t fy) noexcept
+                {
+                    #ifdef DTWAIN_PIXEL_KERNELS_X86
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i round = _mm_set1_epi16(64);
+                    // the left pixels (top row in the low half, bottom row in the high half), and the right pixels
+                    const __m128i left = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(p00)), _mm_cvtsi32_si128(static_cast<int>(p10))), zero);
+                    const __m128i right = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(static_cast<int>(p01)), _mm_cvtsi32_si128(static_cast<int>(p11))), zero);
+                    const __m128i h = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(left, _mm_set1_epi16(static_cast<short>(128 - fx))),
+                                                                                 _mm_mullo_epi16(right, _mm_set1_epi16(static_cast<short>(fx)))), round), 7);
+                    const __m128i wy = _mm_unpacklo_epi64(_mm_set1_epi16(static_cast<short>(128 - fy)), _mm_set1_epi16(static_cast<short>(fy)));
+                    __m128i v = _mm_mullo_epi16(h, wy);
+                    v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, _mm_srli_si128(v, 8)), round), 7);
+                    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(v, zero)));
+                    #else
+                    uint32_t result = 0;
+                    for (int shift = 0; shift < 32; shift += 8)
+                    {
+                        const uint32_t t = (((p00 >> shift) & 0xFF) * (128 - fx) + ((p01 >> shift) & 0xFF) * fx + 64) >> 7;
+                        const uint32_t b = (((p10 >> shift) & 0xFF) * (128 - fx) + ((p11 >> shift) & 0xFF) * fx + 64) >> 7;
+                        result |= ((t * (128 - fy) + b * fy + 64) >> 7) << shift;
+                    }
+                    return result;
+                    #endif
+                }
+
+                #ifdef DTWAIN_PIXEL_KERNELS_X86
+                template <int Lane>
+                static void gather_gray(const unsigned char* data, int64_t stride, int64_t& sx, int64_t& sy, int64_t step_x, int64_t step_y,
+                                        __m128i& top, __m128i& bottom, __m128i& fx, __m128i& fy) noexcept
+                {
+                    const unsigned char* p = data + (sy >> 16) * stride + (sx >> 16);
+                    uint16_t t, b;
+                    std::memcpy(&t, p, 2);
+                    std::memcpy(&b, p + stride, 2);
+                    top = _mm_insert_epi16(top, t, Lane);
+                    bottom = _mm_insert_epi16(bottom, b, Lane);
+                    fx = _mm_insert_epi16(fx, static_cast<int>((sx & 0xFFFF) >> 9), Lane);
+                    fy = _mm_insert_epi16(fy, static_cast<int>((sy & 0xFFFF) >> 9), Lane);
+                    sx += step_x;
+                    sy += step_y;
+                }
+
+                // interpolates gray pixels eight at a time, from x up to (not including) end, and advances x, sx and sy
+                static void gray_span_sse2(const image_view& src, unsigned char* out, int32_t& x, int32_t end, int64_t& sx, int64_t& sy,
+                                           int64_t step_x, int64_t step_y) noexcept
+                {
+                    const __m128i w128 = _mm_set1_epi16(128);
+                    const __m128i round = _mm_set1_epi16(64);
+                    const __m128i low_byte = _mm_set1_epi16(0xFF);
+                    const int64_t stride = src.stride;
+                    for (; x + 8 <= end; x += 8)
+                    {
+                        // each 16-bit lane of top and bottom holds a pixel and its right neighbor
+                        __m128i top = _mm_setzero_si128(), bottom = top, fx = top, fy = top;
+                        gather_gray<0>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<1>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<2>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<3>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<4>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<5>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<6>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        gather_gray<7>(src.data, stride, sx, sy, step_x, step_y, top, bottom, fx, fy);
+                        const __m128i gx = _mm_sub_epi16(w128, fx);
+                        const __m128i t = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(
+                            _mm_mullo_epi16(_mm_and_si128(top, low_byte), gx), _mm_mullo_epi16(_mm_srli_epi16(top, 8), fx)), round), 7);
+                        const __m128i b = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(
+                            _mm_mullo_epi16(_mm_and_si128(bottom, low_byte), gx), _mm_mullo_epi16(_mm_srli_epi16(bottom, 8), fx)), round), 7);
+                        const __m128i v = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(
+                            _mm_mullo_epi16(t, _mm_sub_epi16(w128, fy)), _mm_mullo_epi16(b, fy)), round), 7);
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(v, v));
+                    }
+                }
+                #endif
+
+                // **true** if the source position can be sampled without bounds checks
+                template <pixel_format F>
+                static bool is_inside(const image_view& src, int64_t sx, int64_t sy) noexcept
+                {
+                    if (interpolates(F))
+                    {
+                        const int64_t x0 = sx >> 16, y0 = sy >> 16;
+                        return x0 >= 0 && y0 >= 0 && x0 + 1 < src.width && y0 + 1 < src.height;
+                    }
+                    const int64_t nx = (sx + 0x8000) >> 16, ny = (sy + 0x8000) >> 16;
+                    return nx >= 0 && ny >= 0 && nx < src.width && ny < src.height;
+                }
+
+                template <pixel_format F>
+                static uint32_t sample_inside(const image_view& src, int64_t sx, int64_t sy) noexcept
+                {
+                    if (interpolates(F))
+                    {
+                        const uint32_t fx = static_cast<uint32_t>((sx & 0xFFFF) >> 9);
+                        const uint32_t fy = static_cast<uint32_t>((sy & 0xFFFF) >> 9);
+                        const unsigned char* r0 = src.row(static_cast<int32_t>(sy >> 16));
+                        const unsigned char* r1 = r0 + src.stride;
+                        const int32_t x = static_cast<int32_t>(sx >> 16);
+                        if (F == pixel_format::gray8)
+                        {
+                            const uint32_t t = (r0[x] * (128 - fx) + r0[x + 1] * fx + 64) >> 7;
+                            const uint32_t b = (r1[x] * (128 - fx) + r1[x + 1] * fx + 64) >> 7;
+                            return (t * (128 - fy) + b * fy + 64) >> 7;
+                        }
+                        return blend(get_pixel<F>(r0, x), get_pixel<F>(r0, x + 1), get_pixel<F>(r1, x), get_pixel<F>(r1, x + 1), fx, fy);
+                    }
+                    return get_pixel<F>(src.row(static_cast<int32_t>((sy + 0x8000) >> 16)), static_cast<int32_t>((sx + 0x8000) >> 16));
+                }
+
+                template <pixel_format F>
+                static uint32_t sample(const image_view& src, int64_t sx, int64_t sy, uint32_t background) noexcept
+                {
+                    if (is_inside<F>(src, sx, sy))
+                        return sample_inside<F>(src, sx, sy);
+                    if (!interpolates(F))
+                        return background;
+                    // at the edges of the page interpolated formats take the nearest pixel
+                    const int64_t nx = (sx + 0x8000) >> 16, ny = (sy + 0x8000) >> 16;
+                    if (nx < 0 || ny < 0 || nx >= src.width || ny >= src.height)
+                        return background;
+                    return get_pixel<F>(src.row(static_cast<int32_t>(ny)), static_cast<int32_t>(nx));
+                }
+        };
+
+        /// The outcome of deskewing a page
+        struct deskew_result
+        {
+            skew_estimate skew;             ///< the skew that was measured
+            bool rotated = false;           ///< **false** if the skew was too small to correct, or could not be measured
+            bool verified = false;          ///< **true** if the page was measured again after it was rotated
+            double residual_angle = 0;      ///< the skew measured after rotation, if verified
+            double estimate_ms = 0;         ///< time taken to measure the skew
+            double rotate_ms = 0;           ///< time taken to rotate the page
+            double verify_ms = 0;
+            size_t page_number = 0;         ///< 0-based position of the page in its acquisition
+        };
+
+        /// Measures the skew of DIBs and rotates them in place (see skew_estimator and page_rotator)
+        class page_deskewer
+        {
+            skew_estimator m_estimator;
+            double m_min_angle = 0.1;
+            bool m_verify = false;
+            std::vector<unsigned char> m_copy;
+
+            static double elapsed_ms(std::chrono::steady_clock::time_point start)
+            {
+                return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            }
+
+        public:
+            /// Sets the largest skew (in degrees) that is searched for and corrected
+            page_deskewer& set_max_angle(double degrees) noexcept { m_estimator.set_max_angle(degrees); return *this; }
+
+            /// Sets the smallest skew (in degrees) that is corrected
+            page_deskewer& set_min_angle(double degrees) noexcept { m_min_angle = degrees; return *this; }
+
+            /// Sets whether the skew of each rotated page is measured again, to report the accuracy of the rotation
+            page_deskewer& set_verify(bool verify) noexcept { m_verify = verify; return *this; }
+
+            /// Measures the skew of the DIB at **dib** (**size** bytes) and removes it, in place
+            deskew_result process(void* dib, size_t size)
+            {
+                deskew_result result;
+                const image_view view = image_view::from_dib(dib, size);
+                if (view.empty())
+                    return result;
+                auto start = std::chrono::steady_clock::now();
+                result.skew = m_estimator.estimate(view);
+                result.estimate_ms = elapsed_ms(start);
+                if (!result.skew.valid || std::fabs(result.skew.angle) < m_min_angle)
+                    return result;
+
+                // rotate from a copy of the DIB into the DIB itself
+                start = std::chrono::steady_clock::now();
+                m_copy.assign(static_cast<const unsigned char*>(dib), static_cast<const unsigned char*>(dib) + size);
+                const image_view copy = image_view::from_dib(m_copy.data(), m_copy.size());
+                unsigned char* dest = static_cast<unsigned char*>(dib) + (view.data - static_cast<const unsigned char*>(dib));
+                result.rotated = page_rotator::remove_skew(copy, dest, view.stride, result.skew.angle);
+                result.rotate_ms = elapsed_ms(start);
+
+                if (result.rotated && m_verify)
+                {
+                    start = std::chrono::steady_clock::now();
+                    const skew_estimate residual = m_estimator.estimate(view);
+                    result.verify_ms = elapsed_ms(start);
+                    result.verified = residual.valid;
+                    result.residual_angle = residual.angle;
+                }
+                return result;
+            }
+        };
+    }
+}
+#endif
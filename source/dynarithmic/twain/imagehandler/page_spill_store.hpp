@@ -0,0 +1,372 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_PAGE_SPILL_STORE_HPP
+#define DTWAIN_PAGE_SPILL_STORE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <dtwain.h>
+#include <dynarithmic/twain/source/memory_budget.hpp>
+#include <dynarithmic/twain/types/twain_global_memory.hpp>
+#include <dynarithmic/twain/types/twain_mapped_file.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        struct page_spill_stats
+        {
+            size_t max_resident_bytes = 0;
+            size_t resident_bytes = 0;      ///< bytes of tracked pages currently in memory
+            size_t peak_resident_bytes = 0;
+            size_t resident_pages = 0;
+            size_t spilled_pages = 0;       ///< pages currently held in the spill file
+            uint64_t spill_count = 0;       ///< number of times a page was moved to the spill file
+            uint64_t restore_count = 0;     ///< number of times a page was mapped back into memory
+            uint64_t file_size = 0;
+        };
+
+        /// Moves the least recently used acquired pages (DIBs) to a memory-mapped temporary file when the pages held in
+        /// memory exceed a threshold, and restores them when they are accessed.
+        ///
+        /// A spilled page keeps its HANDLE: the memory block is shrunk, and reallocated and refilled from the file when
+        /// the page is accessed through ensure_resident() (which image_handler does for every page it returns), so the
+        /// handles held by an image_handler do not change when pages are spilled.  Only pages that are accessed exclusively
+        /// through ensure_resident() may be added to a store: a page that DTWAIN or an application still uses directly could
+        /// be shrunk under it (see image_handler::set_spill_store()).
+        ///
+        /// Every page added to a store is recorded in a process-wide registry, so that an image_handler can find the store
+        /// of any HANDLE it is given.
+        /// @note Spilling is only done for Windows global memory handles.  On other platforms pages are never spilled.
+        class page_spill_store
+        {
+            struct region
+            {
+                uint64_t offset;
+                size_t size;
+                bool charged;   // the page was released from the memory budget when it was spilled
+            };
+
+            struct registry_type
+            {
+                std::mutex mutex;
+                std::unordered_map<HANDLE, std::weak_ptr<page_spill_store>> stores;
+            };
+
+            mutable std::mutex m_mutex;
+            std::weak_ptr<page_spill_store> m_self;
+            twain_mapped_file m_file;
+            size_t m_nMaxResident;
+            std::list<HANDLE> m_lru;    // most recently used at the front
+            std::unordered_map<HANDLE, std::pair<std::list<HANDLE>::iterator, size_t>> m_resident;
+            std::unordered_map<HANDLE, region> m_spilled;
+            std::multimap<size_t, uint64_t> m_free_regions;
+            std::unordered_map<HANDLE, size_t> m_pins;  // pages that may not be spilled, and their pin counts
+            page_spill_stats m_stats;
+            std::shared_ptr<memory_budget> m_memory_budget;
+
+            static registry_type& get_registry()
+            {
+                static registry_type registry;
+                return registry;
+            }
+
+            page_spill_store(size_t max_resident_bytes) : m_nMaxResident(max_resident_bytes)
+            {
+                m_stats.max_resident_bytes = max_resident_bytes;
+            }
+
+            void make_resident_locked(HANDLE h, size_t size)
+            {
+                m_lru.push_front(h);
+                m_resident[h] = { m_lru.begin(), size };
+                m_stats.resident_bytes += size;
+                m_stats.peak_resident_bytes = (std::max)(m_stats.peak_resident_bytes, m_stats.resident_bytes);
+            }
+
+            void remove_resident_locked(HANDLE h)
+            {
+                auto iter = m_resident.find(h);
+                if (iter == m_resident.end())
+                    return;
+                m_stats.resident_bytes -= iter->second.second;
+                m_lru.erase(iter->second.first);
+                m_resident.erase(iter);
+            }
+
+            uint64_t allocate_region_locked(const void* data, size_t size)
+            {
+                auto iter = m_free_regions.find(size);
+                if (iter != m_free_regions.end())
+                {
+                    const uint64_t offset = iter->second;
+                    m_free_regions.erase(iter);
+                    m_file.write(offset, data, size);
+                    return offset;
+                }
+                if (!m_file.is_open())
+                    return twain_mapped_file::npos;
+                return m_file.append(data, size);
+            }
+
+            bool spill_locked(HANDLE h)
+            {
+                auto iter = m_resident.find(h);
+                if (iter == m_resident.end())
+                    return false;
+                const size_t size = iter->second.second;
+                void* p = twain_global_memory::lock(h);
+                // a fixed block cannot keep its HANDLE when reallocated
+                if (!p || !twain_global_memory::is_moveable(h, p))
+                {
+                    if (p)
+                        twain_global_memory::unlock(h);
+                    return false;
+                }
+                const uint64_t offset = allocate_region_locked(p, size);
+                twain_global_memory::unlock(h);
+                if (offset == twain_mapped_file::npos)
+                    return false;
+                if (!twain_global_memory::resize(h, 1))
+                {
+                    m_free_regions.insert({ size, offset });
+                    return false;
+                }
+                remove_resident_locked(h);
+                // the page no longer takes memory
+                const bool charged = m_memory_budget && m_memory_budget->release(h);
+                m_spilled[h] = { offset, size, charged };
+                ++m_stats.spill_count;
+                return true;
+            }
+
+            // spills the least recently used pages (other than **keep** and the pinned pages) until the resident bytes are within the limit
+            void enforce_limit_locked(HANDLE keep)
+            {
+                auto iter = m_lru.end();
+                while (m_stats.resident_bytes > m_nMaxResident && iter != m_lru.begin())
+                {
+                    // a spilled page is removed from m_lru, which leaves **iter** valid
+                    auto candidate = std::prev(iter);
+                    if (*candidate == keep || m_pins.count(*candidate) || !spill_locked(*candidate))
+                        iter = candidate;
+                }
+            }
+
+            bool restore_locked(HANDLE h)
+            {
+                auto iter = m_spilled.find(h);
+                if (iter == m_spilled.end())
+                    return false;
+                const region r = iter->second;
+                if (!twain_global_memory::resize(h, r.size))
+                    return false;
+                void* p = twain_global_memory::lock(h);
+                if (!p)
+                    return false;
+                m_file.read(r.offset, p, r.size);
+                twain_global_memory::unlock(h);
+                m_spilled.erase(iter);
+                m_free_regions.insert({ r.size, r.offset });
+                make_resident_locked(h, r.size);
+                if (r.charged)
+                    m_memory_budget->charge(h, r.size);
+                ++m_stats.restore_count;
+                return true;
+            }
+
+            void touch_locked(HANDLE h)
+            {
+                auto iter = m_resident.find(h);
+                if (iter != m_resident.end())
+                    m_lru.splice(m_lru.begin(), m_lru, iter->second.first);
+            }
+
+        public:
+            page_spill_store(const page_spill_store&) = delete;
+            page_spill_store& operator=(const page_spill_store&) = delete;
+
+            ~page_spill_store()
+            {
+                auto& registry = get_registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (auto& pr : m_resident)
+                    registry.stores.erase(pr.first);
+                for (auto& pr : m_spilled)
+                    registry.stores.erase(pr.first);
+            }
+
+            /// Creates a store that keeps at most **max_resident_bytes** of pages in memory.
+            /// @param[in] max_resident_bytes The threshold above which pages are spilled
+            /// @param[in] directory The directory of the spill file.  If empty, the system temporary directory is used.
+            /// @returns the store, or **nullptr** if the spill file could not be created.
+            static std::shared_ptr<page_spill_store> create(size_t max_resident_bytes, const std::string& directory)
+            {
+                std::shared_ptr<page_spill_store> store(new page_spill_store(max_resident_bytes));
+                store->m_self = store;
+                if (!store->m_file.open(twain_mapped_file::make_temp_path(directory, "dtwain_spill_"), true, true))
+                    return nullptr;
+                return store;
+            }
+
+            /// Sets the memory budget that a page is released from when it is spilled, and charged to again when it is
+            /// restored.  Must be set before pages are added.
+            void set_memory_budget(std::shared_ptr<memory_budget> budget)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_memory_budget = std::move(budget);
+            }
+
+            /// Starts tracking the page **h**, which is resident.  Older pages are spilled if the threshold is exceeded.
+            void add_page(HANDLE h)
+            {
+                if (!h)
+                    return;
+                {
+                    auto& registry = get_registry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    registry.stores[h] = m_self;
+                }
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_resident.count(h) || m_spilled.count(h))
+                    return;
+                make_resident_locked(h, twain_global_memory::size(h));
+                enforce_limit_locked(nullptr);
+            }
+
+            /// Returns the store that tracks the page **h**, or **nullptr** if the page is not tracked by any store
+            static std::shared_ptr<page_spill_store> find_store(HANDLE h)
+            {
+                auto& registry = get_registry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                auto iter = registry.stores.find(h);
+                return iter == registry.stores.end() ? nullptr : iter->second.lock();
+            }
+
+            /// Makes sure that the page **h** is in memory, restoring it from the spill file if necessary.  Other pages
+            /// may be spilled to make room for it.
+            /// @returns **h**, or **nullptr** if the page is spilled and could not be restored (for example, if there is
+            /// not enough memory).  The page is then still held in the spill file, and can be restored later.
+            static HANDLE ensure_resident(HANDLE h)
+            {
+                auto store = find_store(h);
+                if (!store)
+                    return h;
+                std::lock_guard<std::mutex> lock(store->m_mutex);
+                if (!store->m_spilled.count(h))
+                {
+                    store->touch_locked(h);
+                    return h;
+                }
+                if (!store->restore_locked(h))
+                    return nullptr;
+                store->enforce_limit_locked(h);
+                return h;
+            }
+
+            /// Restores the page **h** if necessary, and keeps it in memory until unpin() is called as many times as pin().
+            /// @returns **h**, or **nullptr** if the page could not be restored (the page is then not pinned).
+            static HANDLE pin(HANDLE h)
+            {
+                auto store = find_store(h);
+                if (!store)
+                    return h;
+                std::lock_guard<std::mutex> lock(store->m_mutex);
+                if (!store->m_spilled.count(h))
+                    store->touch_locked(h);
+                else if (!store->restore_locked(h))
+                    return nullptr;
+                ++store->m_pins[h];
+                store->enforce_limit_locked(h);
+                return h;
+            }
+
+            /// Allows the page **h**, pinned with pin(), to be spilled again
+            static void unpin(HANDLE h)
+            {
+                auto store = find_store(h);
+                if (!store)
+                    return;
+                std::lock_guard<std::mutex> lock(store->m_mutex);
+                auto iter = store->m_pins.find(h);
+                if (iter != store->m_pins.end() && --iter->second == 0)
+                {
+                    store->m_pins.erase(iter);
+                    store->enforce_limit_locked(nullptr);
+                }
+            }
+
+            /// Stops tracking the page **h**.  Must be called before a tracked page is freed.
+            /// @note A spilled page is not restored, so the (shrunk) HANDLE can be freed immediately.
+            static void forget(HANDLE h)
+            {
+                std::shared_ptr<page_spill_store> store;
+                {
+                    auto& registry = get_registry();
+                    std::lock_guard<std::mutex> lock(registry.mutex);
+                    auto iter = registry.stores.find(h);
+                    if (iter == registry.stores.end())
+                        return;
+                    store = iter->second.lock();
+                    registry.stores.erase(iter);
+                }
+                if (!store)
+                    return;
+                std::lock_guard<std::mutex> lock(store->m_mutex);
+                store->m_pins.erase(h);
+                store->remove_resident_locked(h);
+                auto iter = store->m_spilled.find(h);
+                if (iter != store->m_spilled.end())
+                {
+                    store->m_free_regions.insert({ iter->second.size, iter->second.offset });
+                    store->m_spilled.erase(iter);
+                }
+            }
+
+            /// Returns **true** if the page **h** is currently held in the spill file
+            bool is_spilled(HANDLE h) const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_spilled.count(h) != 0;
+            }
+
+            page_spill_stats get_stats() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                page_spill_stats stats = m_stats;
+                stats.resident_pages = m_resident.size();
+                stats.spilled_pages = m_spilled.size();
+                stats.file_size = m_file.size();
+                return stats;
+            }
+
+            const std::string& get_path() const noexcept { return m_file.get_path(); }
+        };
+    }
+}
+#endif
@@ -0,0 +1,392 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_PIXEL_KERNELS_HPP
+#define DTWAIN_PIXEL_KERNELS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <dynarithmic/twain/imagehandler/dib_info.hpp>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define DTWAIN_PIXEL_KERNELS_X86
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+        #define DTWAIN_TARGET_SSSE3
+        #define DTWAIN_TARGET_AVX2
+    #else
+        #define DTWAIN_TARGET_SSSE3 __attribute__((target("ssse3")))
+        #define DTWAIN_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #define DTWAIN_PIXEL_KERNELS_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Instruction sets available on the running CPU
+        struct cpu_features
+        {
+            bool ssse3 = false;
+            bool avx2 = false;
+
+            static const cpu_features& get()
+            {
+                static const cpu_features features = detect();
+                return features;
+            }
+
+            private:
+                static cpu_features detect()
+                {
+                    cpu_features features;
+                    #if defined(DTWAIN_PIXEL_KERNELS_X86) && defined(_MSC_VER)
+                    int regs[4];
+                    __cpuid(regs, 0);
+                    const int max_leaf = regs[0];
+                    __cpuid(regs, 1);
+                    features.ssse3 = (regs[2] & (1 << 9)) != 0;
+                    // AVX2 also needs the operating system to save the YMM registers
+                    const bool os_avx = (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+                    if (os_avx && max_leaf >= 7)
+                    {
+                        __cpuidex(regs, 7, 0);
+                        features.avx2 = (regs[1] & (1 << 5)) != 0;
+                    }
+                    #elif defined(DTWAIN_PIXEL_KERNELS_X86)
+                    __builtin_cpu_init();
+                    features.ssse3 = __builtin_cpu_supports("ssse3") != 0;
+                    features.avx2 = __builtin_cpu_supports("avx2") != 0;
+                    #endif
+                    return features;
+                }
+        };
+
+        /// Pixel format conversion and row order kernels for DIB memory.
+        ///
+        /// Each kernel picks the fastest implementation for the running CPU (AVX2, SSSE3 or SSE2 on x86, portable code
+        /// elsewhere) the first time it is called.  Kernels that work in place say so.
+        struct pixel_kernels
+        {
+            /// Swaps the first and third bytes of each of the **pixels** pixels at **data** (BGR <-> RGB), in place.
+            /// @param[in] bytes_per_pixel 3 or 4
+            static void swap_red_blue(unsigned char* data, size_t pixels, int bytes_per_pixel)
+            {
+                using func = void(*)(unsigned char*, size_t);
+                static const func impl24 = select<func>(&swap_red_blue24_scalar, ssse3_or_null(&swap_red_blue24_ssse3), nullptr);
+                static const func impl32 = select<func>(&swap_red_blue32_scalar, ssse3_or_null(&swap_red_blue32_ssse3), avx2_or_null(&swap_red_blue32_avx2));
+                if (bytes_per_pixel == 3)
+                    impl24(data, pixels * 3);
+                else if (bytes_per_pixel == 4)
+                    impl32(data, pixels * 4);
+            }
+
+            /// Reverses the order of **rows** rows of **row_bytes** bytes, **stride** bytes apart, in place
+            static void flip_rows(unsigned char* data, size_t row_bytes, size_t stride, size_t rows)
+            {
+                using func = void(*)(unsigned char*, unsigned char*, size_t);
+                static const func impl = select<func>(&swap_bytes_scalar, sse2_or_null(&swap_bytes_sse2), avx2_or_null(&swap_bytes_avx2));
+                for (size_t top = 0, bottom = rows ? rows - 1 : 0; top < bottom; ++top, --bottom)
+                    impl(data + top * stride, data + bottom * stride, row_bytes);
+            }
+
+            /// Converts **samples** 16-bit little-endian samples at **src** to 8 bits (the high byte of each sample).
+            /// **dest** may be the same as **src**.
+            static void reduce_16_to_8(const unsigned char* src, unsigned char* dest, size_t samples)
+            {
+                using func = void(*)(const unsigned char*, unsigned char*, size_t);
+                static const func impl = select<func>(&reduce_16_to_8_scalar, sse2_or_null(&reduce_16_to_8_sse2), avx2_or_null(&reduce_16_to_8_avx2));
+                impl(src, dest, samples);
+            }
+
+            /// Expands **count** 8-bit palette indexes at **src** to 32-bit pixels (BGRX) at **dest**, using the 256 entry
+            /// **palette** of RGBQUADs.  Missing entries must be filled (for example with 0) by the caller.
+            static void expand_palette32(const unsigned char* src, unsigned char* dest, size_t count, const uint32_t* palette)
+            {
+                using func = void(*)(const unsigned char*, unsigned char*, size_t, const uint32_t*);
+                static const func impl = select<func>(&expand_palette32_scalar, nullptr, avx2_or_null(&expand_palette32_avx2));
+                impl(src, dest, count, palette);
+            }
+
+            /// Expands **count** 8-bit palette indexes at **src** to 24-bit pixels (BGR) at **dest**
+            static void expand_palette24(const unsigned char* src, unsigned char* dest, size_t count, const uint32_t* palette)
+            {
+                for (size_t i = 0; i < count; ++i, dest += 3)
+                {
+                    const uint32_t entry = palette[src[i]];
+                    dest[0] = static_cast<unsigned char>(entry);
+                    dest[1] = static_cast<unsigned char>(entry >> 8);
+                    dest[2] = static_cast<unsigned char>(entry >> 16);
+                }
+            }
+
+            /// Unpacks **count** 1-bit or 4-bit palette indexes (most significant first) at **src** to one byte each at **dest**
+            static void unpack_indexes(const unsigned char* src, unsigned char* dest, size_t count, int bits_per_pixel)
+            {
+                if (bits_per_pixel == 1)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        dest[i] = (src[i >> 3] >> (7 - (i & 7))) & 1;
+                }
+                else if (bits_per_pixel == 4)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        dest[i] = (src[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F;
+                }
+                else
+                    std::memcpy(dest, src, count);
+            }
+
+            /// Copies **rows** rows of **row_bytes** bytes, **src_stride** bytes apart, to consecutive rows at **dest**,
+            /// removing the row padding.  **dest** may be the same as **src**.
+            static void remove_padding(const unsigned char* src, size_t src_stride, unsigned char* dest, size_t row_bytes, size_t rows)
+            {
+                for (size_t y = 0; y < rows; ++y)
+                    std::memmove(dest + y * row_bytes, src + y * src_stride, row_bytes);
+            }
+
+            /// Reverses the rows of the uncompressed DIB at **dib** (of **size** bytes) in place.  The header is not changed.
+            /// @returns **false** if **dib** is not an uncompressed DIB
+            static bool flip_dib(void* dib, size_t size)
+            {
+                dib_info info;
+                if (!info.parse(dib, size))
+                    return false;
+                flip_rows(static_cast<unsigned char*>(dib) + info.header_size, info.row_bytes, info.row_bytes, static_cast<size_t>(info.height));
+                return true;
+            }
+
+            /// Makes the uncompressed DIB at **dib** top-down (first row in memory is the top row) in place
+            /// @returns **false** if **dib** is not an uncompressed DIB
+            static bool make_top_down(void* dib, size_t size)
+            {
+                dib_info info;
+                if (!info.parse(dib, size))
+                    return false;
+                if (info.is_bottom_up)
+                {
+                    flip_dib(dib, size);
+                    const int32_t height = -info.height;
+                    std::memcpy(static_cast<unsigned char*>(dib) + 8, &height, sizeof height);
+                }
+                return true;
+            }
+
+            private:
+                template <typename F>
+                static F select(F portable, F sse, F avx2)
+                {
+                    return avx2 ? avx2 : (sse ? sse : portable);
+                }
+
+                template <typename F>
+                static F sse2_or_null(F f)
+                {
+                    #ifdef DTWAIN_PIXEL_KERNELS_X86
+                    return f;   // every x86 CPU this library supports has SSE2
+                    #else
+                    (void)f;
+                    return nullptr;
+                    #endif
+                }
+
+                template <typename F>
+                static F ssse3_or_null(F f) { return cpu_features::get().ssse3 ? f : nullptr; }
+
+                template <typename F>
+                static F avx2_or_null(F f) { return cpu_features::get().avx2 ? f : nullptr; }
+
+                static void swap_red_blue24_scalar(unsigned char* p, size_t size)
+                {
+                    for (size_t i = 0; i + 3 <= size; i += 3)
+                        std::swap(p[i], p[i + 2]);
+                }
+
+                static void swap_red_blue32_scalar(unsigned char* p, size_t size)
+                {
+                    for (size_t i = 0; i + 4 <= size; i += 4)
+                        std::swap(p[i], p[i + 2]);
+                }
+
+                static void swap_bytes_scalar(unsigned char* a, unsigned char* b, size_t size)
+                {
+                    std::swap_ranges(a, a + size, b);
+                }
+
+                static void reduce_16_to_8_scalar(const unsigned char* src, unsigned char* dest, size_t samples)
+                {
+                    for (size_t i = 0; i < samples; ++i)
+                        dest[i] = src[2 * i + 1];
+                }
+
+                static void expand_palette32_scalar(const unsigned char* src, unsigned char* dest, size_t count, const uint32_t* palette)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        std::memcpy(dest + 4 * i, &palette[src[i]], 4);
+                }
+
+                #ifdef DTWAIN_PIXEL_KERNELS_X86
+                // shuffle masks for 16 pixels (48 bytes, three registers): output register r takes its bytes from
+                // input register s through masks[r][s].  Bytes that come from another register are zeroed (0x80).
+                struct swap24_masks
+                {
+                    alignas(16) unsigned char masks[3][3][16];
+                    swap24_masks()
+                    {
+                        std::memset(masks, 0x80, sizeof masks);
+                        for (int j = 0; j < 48; ++j)
+                        {
+                            const int src = 3 * (j / 3) + 2 - j % 3;
+                            masks[j / 16][src / 16][j % 16] = static_cast<unsigned char>(src % 16);
+                        }
+                    }
+                };
+
+                DTWAIN_TARGET_SSSE3 static void swap_red_blue24_ssse3(unsigned char* p, size_t size)
+                {
+                    static const swap24_masks m;
+                    auto mask = [&](int r, int s) { return _mm_load_si128(reinterpret_cast<const __m128i*>(m.masks[r][s])); };
+                    const __m128i m00 = mask(0, 0), m01 = mask(0, 1);
+                    const __m128i m10 = mask(1, 0), m11 = mask(1, 1), m12 = mask(1, 2);
+                    const __m128i m21 = mask(2, 1), m22 = mask(2, 2);
+                    size_t i = 0;
+                    for (; i + 48 <= size; i += 48)
+                    {
+                        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 16));
+                        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 32));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_or_si128(_mm_shuffle_epi8(a, m00), _mm_shuffle_epi8(b, m01)));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i + 16),
+                                         _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m10), _mm_shuffle_epi8(b, m11)), _mm_shuffle_epi8(c, m12)));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i + 32), _mm_or_si128(_mm_shuffle_epi8(b, m21), _mm_shuffle_epi8(c, m22)));
+                    }
+                    swap_red_blue24_scalar(p + i, size - i);
+                }
+
+                DTWAIN_TARGET_SSSE3 static void swap_red_blue32_ssse3(unsigned char* p, size_t size)
+                {
+                    const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+                    size_t i = 0;
+                    for (; i + 16 <= size; i += 16)
+                    {
+                        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_shuffle_epi8(v, mask));
+                    }
+                    swap_red_blue32_scalar(p + i, size - i);
+                }
+
+                DTWAIN_TARGET_AVX2 static void swap_red_blue32_avx2(unsigned char* p, size_t size)
+                {
+                    const __m256i mask = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                                          2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+                    size_t i = 0;
+                    for (; i + 32 <= size; i += 32)
+                    {
+                        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p + i), _mm256_shuffle_epi8(v, mask));
+                    }
+                    swap_red_blue32_scalar(p + i, size - i);
+                }
+
+                static void swap_bytes_sse2(unsigned char* a, unsigned char* b, size_t size)
+                {
+                    size_t i = 0;
+                    for (; i + 16 <= size; i += 16)
+                    {
+                        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), vb);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(b + i), va);
+                    }
+                    swap_bytes_scalar(a + i, b + i, size - i);
+                }
+
+                DTWAIN_TARGET_AVX2 static void swap_bytes_avx2(unsigned char* a, unsigned char* b, size_t size)
+                {
+                    size_t i = 0;
+                    for (; i + 32 <= size; i += 32)
+                    {
+                        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), vb);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), va);
+                    }
+                    swap_bytes_scalar(a + i, b + i, size - i);
+                }
+
+                // in place is safe, since each store is behind the loads of the same iteration
+                static void reduce_16_to_8_sse2(const unsigned char* src, unsigned char* dest, size_t samples)
+                {
+                    size_t i = 0;
+                    for (; i + 16 <= samples; i += 16)
+                    {
+                        const __m128i lo = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i)), 8);
+                        const __m128i hi = _mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i + 16)), 8);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(lo, hi));
+                    }
+                    reduce_16_to_8_scalar(src + 2 * i, dest + i, samples - i);
+                }
+
+                DTWAIN_TARGET_AVX2 static void reduce_16_to_8_avx2(const unsigned char* src, unsigned char* dest, size_t samples)
+                {
+                    size_t i = 0;
+                    for (; i + 32 <= samples; i += 32)
+                    {
+                        const __m256i lo = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i)), 8);
+                        const __m256i hi = _mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i + 32)), 8);
+                        // packus works within 128-bit lanes, so the 64-bit quarters are put back in order
+                        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), packed);
+                    }
+                    reduce_16_to_8_scalar(src + 2 * i, dest + i, samples - i);
+                }
+
+                DTWAIN_TARGET_AVX2 static void expand_palette32_avx2(const unsigned char* src, unsigned char* dest, size_t count, const uint32_t* palette)
+                {
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        const __m256i indexes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+                        const __m256i pixels = _mm256_i32gather_epi32(reinterpret_cast<const int*>(palette), indexes, 4);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 4 * i), pixels);
+                    }
+                    expand_palette32_scalar(src + i, dest + 4 * i, count - i, palette);
+                }
+                #else
+                static void swap_red_blue24_ssse3(unsigned char* p, size_t size) { swap_red_blue24_scalar(p, size); }
+                static void swap_red_blue32_ssse3(unsigned char* p, size_t size) { swap_red_blue32_scalar(p, size); }
+                static void swap_red_blue32_avx2(unsigned char* p, size_t size) { swap_red_blue32_scalar(p, size); }
+                static void swap_bytes_sse2(unsigned char* a, unsigned char* b, size_t size) { swap_bytes_scalar(a, b, size); }
+                static void swap_bytes_avx2(unsigned char* a, unsigned char* b, size_t size) { swap_bytes_scalar(a, b, size); }
+                static void reduce_16_to_8_sse2(const unsigned char* s, unsigned char* d, size_t n) { reduce_16_to_8_scalar(s, d, n); }
+                static void reduce_16_to_8_avx2(const unsigned char* s, unsigned char* d, size_t n) { reduce_16_to_8_scalar(s, d, n); }
+                static void expand_palette32_avx2(const unsigned char* s, unsigned char* d, size_t n, const uint32_t* p) { expand_palette32_scalar(s, d, n, p); }
+                #endif
+        };
+    }
+}
+#endif
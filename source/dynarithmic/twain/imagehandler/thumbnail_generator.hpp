@@ -0,0 +1,329 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_THUMBNAIL_GENERATOR_HPP
+#define DTWAIN_THUMBNAIL_GENERATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
+#include <dynarithmic/twain/imagehandler/pixel_kernels.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A reduced copy of a page: gray8 for bitonal and gray pages, bgr24 for everything else.  Rows are top-down
+        /// and not padded.
+        struct thumbnail
+        {
+            std::vector<unsigned char> pixels;
+            int32_t width = 0;
+            int32_t height = 0;
+            pixel_format format = pixel_format::unknown;
+            int32_t scale = 0;          ///< each thumbnail pixel is the average of scale x scale page pixels
+            size_t page_number = 0;     ///< 0-based position of the page in its acquisition
+
+            bool empty() const noexcept { return pixels.empty(); }
+            image_view get_view() const noexcept
+            {
+                return image_view::from_rows(pixels.data(), width, height, static_cast<int64_t>(width) * (format == pixel_format::gray8 ? 1 : 3), format);
+            }
+        };
+
+        /// Builds thumbnails by averaging square boxes of pixels (an integer reduction that keeps the aspect ratio).
+        ///
+        /// Rows are added to 16-bit column sums as they arrive, so a page can be reduced a strip at a time while it is
+        /// transferred (begin_page(), add_rows(), finish()), or all at once (generate()).  The largest box is 257 x 257 pixels.
+        class thumbnail_generator
+        {
+            int32_t m_max_width = 256;
+            int32_t m_max_height = 256;
+
+            // the page being reduced
+            int32_t m_width = 0;
+            int32_t m_height = 0;
+            int32_t m_scale = 1;
+            int m_channels = 0;
+            int32_t m_rows_added = 0;   // page rows added so far
+            int32_t m_box_rows = 0;     // page rows in the column sums
+            std::vector<uint16_t> m_sums;
+            std::vector<unsigned char> m_row;   // a page row converted to gray8 or bgr24
+            std::vector<unsigned char> m_converted;
+            std::vector<unsigned char> m_indexes;
+            uint64_t m_bw_table[256];
+            thumbnail m_thumbnail;
+
+            // adds the **size** bytes of **row** to the column sums, with AVX2 or SSE2 on x86 (chosen for the running CPU)
+            static void accumulate(uint16_t* sums, const unsigned char* row, size_t size) noexcept
+            {
+                using func = void(*)(uint16_t*, const unsigned char*, size_t);
+                #ifdef DTWAIN_PIXEL_KERNELS_X86
+                static const func impl = cpu_features::get().avx2 ? &accumulate_avx2 : &accumulate_sse2;
+                #else
+                static const func impl = &accumulate_scalar;
+                #endif
+                impl(sums, row, size);
+            }
+
+            static void accumulate_scalar(uint16_t* sums, const unsigned char* row, size_t size) noexcept
+            {
+                for (size_t i = 0; i < size; ++i)
+                    sums[i] = static_cast<uint16_t>(sums[i] + row[i]);
+            }
+
+            #ifdef DTWAIN_PIXEL_KERNELS_X86
+            static void accumulate_sse2(uint16_t* sums, const unsigned char* row, size_t size) noexcept
+            {
+                size_t i = 0;
+                const __m128i zero = _mm_setzero_si128();
+                for (; i + 16 <= size; i += 16)
+                {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+                    __m128i* s = reinterpret_cast<__m128i*>(sums + i);
+                    _mm_storeu_si128(s, _mm_add_epi16(_mm_loadu_si128(s), _mm_unpacklo_epi8(v, zero)));
+                    _mm_storeu_si128(s + 1, _mm_add_epi16(_mm_loadu_si128(s + 1), _mm_unpackhi_epi8(v, zero)));
+                }
+                accumulate_scalar(sums + i, row + i, size - i);
+            }
+
+            DTWAIN_TARGET_AVX2 static void accumulate_avx2(uint16_t* sums, const unsigned char* row, size_t size) noexcept
+            {
+                size_t i = 0;
+                for (; i + 16 <= size; i += 16)
+                {
+                    const __m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i)));
+                    __m256i* s = reinterpret_cast<__m256i*>(sums + i);
+                    _mm256_storeu_si256(s, _mm256_add_epi16(_mm256_loadu_si256(s), v));
+                }
+                accumulate_scalar(sums + i, row + i, size - i);
+            }
+            #endif
+
+            // converts a row of **view** to the thumbnail's format (gray8 or bgr24)
+            const unsigned char* convert_row(const image_view& view, const unsigned char* src, const uint32_t* palette)
+            {
+                const size_t width = static_cast<size_t>(view.width);
+                const unsigned char* row = m_row.data();
+                int channels = 3;
+                switch (view.format)
+                {
+                    case pixel_format::gray8:
+                        row = src;
+                        channels = 1;
+                    break;
+                    case pixel_format::bgr24:
+                        row = src;
+                    break;
+                    case pixel_format::bgrx32:
+                        for (size_t x = 0; x < width; ++x)
+                            std::memcpy(&m_row[x * 3], src + x * 4, 3);
+                    break;
+                    case pixel_format::bgr555:
+                        for (size_t x = 0; x < width; ++x)
+                        {
+                            const unsigned v = src[2 * x] | (src[2 * x + 1] << 8);
+                            m_row[x * 3] = static_cast<unsigned char>((v & 0x1F) << 3);
+                            m_row[x * 3 + 1] = static_cast<unsigned char>(((v >> 5) & 0x1F) << 3);
+                            m_row[x * 3 + 2] = static_cast<unsigned char>(((v >> 10) & 0x1F) << 3);
+                        }
+                    break;
+                    case pixel_format::bw1:
+                        if (m_channels == 1)
+                        {
+                            // eight pixels at a time, from a table of the gray bytes for each bit pattern
+                            for (size_t x = 0; x < width; x += 8)
+                                std::memcpy(&m_row[x], &m_bw_table[src[x / 8]], (std::min)(width - x, size_t(8)));
+                            return m_row.data();
+                        }
+                        // fall through
+                    default:
+                        // palette formats: the palette is already in the thumbnail's format
+                        pixel_kernels::unpack_indexes(src, m_indexes.data(), width, view.bits_per_pixel());
+                        if (m_channels == 1)
+                        {
+                            for (size_t x = 0; x < width; ++x)
+                                m_row[x] = static_cast<unsigned char>(palette[m_indexes[x]]);
+                        }
+                        else
+                            pixel_kernels::expand_palette24(m_indexes.data(), m_row.data(), width, palette);
+                        return m_row.data();
+                }
+                if (channels == m_channels)
+                    return row;
+                // the thumbnail format was chosen for another page format (strips given the wrong format)
+                if (m_channels == 3)
+                {
+                    for (size_t x = width; x-- > 0;)
+                        m_converted[x * 3] = m_converted[x * 3 + 1] = m_converted[x * 3 + 2] = row[x];
+                }
+                else
+                {
+                    for (size_t x = 0; x < width; ++x)
+                        m_converted[x] = static_cast<unsigned char>((row[x * 3] * 29u + row[x * 3 + 1] * 150u + row[x * 3 + 2] * 77u) >> 8);
+                }
+                return m_converted.data();
+            }
+
+            // writes the thumbnail row for the box rows in m_sums
+            void emit_row()
+            {
+                const size_t row_size = static_cast<size_t>(m_thumbnail.width) * m_channels;
+                m_thumbnail.pixels.resize(m_thumbnail.pixels.size() + row_size);
+                unsigned char* out = m_thumbnail.pixels.data() + m_thumbnail.pixels.size() - row_size;
+                const uint32_t area = static_cast<uint32_t>(m_scale) * static_cast<uint32_t>(m_box_rows);
+                for (int32_t x = 0; x < m_thumbnail.width; ++x)
+                {
+                    for (int c = 0; c < m_channels; ++c)
+                    {
+                        uint32_t total = 0;
+                        const uint16_t* s = m_sums.data() + static_cast<size_t>(x) * m_scale * m_channels + c;
+                        for (int32_t k = 0; k < m_scale; ++k, s += m_channels)
+                            total += *s;
+                        *out++ = static_cast<unsigned char>((total + area / 2) / area);
+                    }
+                }
+                std::fill(m_sums.begin(), m_sums.end(), uint16_t(0));
+                m_box_rows = 0;
+                ++m_thumbnail.height;
+            }
+
+            // palette entries as gray levels (one channel) or RGBQUADs (three channels)
+            void make_palette(const image_view& view, uint32_t* palette) const noexcept
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    const bool have = view.palette && i < view.palette_entries;
+                    const unsigned char* e = have ? view.palette + i * 4 : nullptr;
+                    if (m_channels == 1)
+                    {
+                        // without a palette, bitonal 0 is black
+                        palette[i] = e ? (e[0] * 29u + e[1] * 150u + e[2] * 77u) >> 8 : (view.format == pixel_format::bw1 && i ? 255u : i);
+                    }
+                    else
+                        palette[i] = e ? (e[0] | (e[1] << 8) | (e[2] << 16)) : (i | (i << 8) | (i << 16));
+                }
+            }
+
+            static bool is_gray(const image_view& view) noexcept
+            {
+                if (view.format == pixel_format::gray8 || view.format == pixel_format::bw1)
+                    return true;
+                if (view.format != pixel_format::indexed4 && view.format != pixel_format::indexed8)
+                    return false;
+                for (uint32_t i = 0; view.palette && i < view.palette_entries; ++i)
+                {
+                    const unsigned char* e = view.palette + i * 4;
+                    if (e[0] != e[1] || e[1] != e[2])
+                        return false;
+                }
+                return true;
+            }
+
+        public:
+            /// Sets the largest thumbnail size.  Thumbnails keep the page's aspect ratio, so usually only one side is at its limit.
+            thumbnail_generator& set_max_size(int32_t max_width, int32_t max_height) noexcept
+            {
+                m_max_width = (std::max)(max_width, 1);
+                m_max_height = (std::max)(max_height, 1);
+                return *this;
+            }
+
+            int32_t get_max_width() const noexcept { return m_max_width; }
+            int32_t get_max_height() const noexcept { return m_max_height; }
+
+            /// Starts a thumbnail of a page of **width** x **height** pixels.  **gray** selects a gray8 thumbnail.
+            void begin_page(int32_t width, int32_t height, bool gray)
+            {
+                m_width = (std::max)(width, 0);
+                m_height = (std::max)(height, 0);
+                const int32_t scale_x = (m_width + m_max_width - 1) / m_max_width;
+                const int32_t scale_y = (m_height + m_max_height - 1) / m_max_height;
+                m_scale = (std::min)((std::max)((std::max)(scale_x, scale_y), 1), 257);
+                m_channels = gray ? 1 : 3;
+                m_rows_added = 0;
+                m_box_rows = 0;
+                m_thumbnail = thumbnail();
+                m_thumbnail.width = m_width / m_scale;
+                m_thumbnail.format = gray ? pixel_format::gray8 : pixel_format::bgr24;
+                m_thumbnail.scale = m_scale;
+                m_thumbnail.pixels.reserve(static_cast<size_t>(m_thumbnail.width) * (m_height / m_scale) * m_channels);
+                m_sums.assign(static_cast<size_t>(m_thumbnail.width) * m_scale * m_channels, 0);
+                m_row.resize(static_cast<size_t>(m_width) * 3 + 8);
+                m_converted.resize(static_cast<size_t>(m_width) * 3);
+                m_indexes.resize(static_cast<size_t>(m_width));
+            }
+
+            /// Adds the next rows of the page (top row first).  **rows** must have the width given to begin_page().
+            void add_rows(const image_view& rows)
+            {
+                if (rows.empty() || rows.width != m_width || m_thumbnail.width == 0)
+                    return;
+                uint32_t palette[256];
+                make_palette(rows, palette);
+                if (rows.format == pixel_format::bw1)
+                {
+                    for (unsigned pattern = 0; pattern < 256; ++pattern)
+                    {
+                        unsigned char bytes[8];
+                        for (int bit = 0; bit < 8; ++bit)
+                            bytes[bit] = static_cast<unsigned char>(palette[(pattern >> (7 - bit)) & 1]);
+                        std::memcpy(&m_bw_table[pattern], bytes, 8);
+                    }
+                }
+                // rows past the last whole box are dropped
+                const int32_t thumbnail_rows = m_height / m_scale;
+                for (int32_t y = 0; y < rows.height && m_rows_added < m_height; ++y, ++m_rows_added)
+                {
+                    if (m_thumbnail.height >= thumbnail_rows)
+                        break;
+                    accumulate(m_sums.data(), convert_row(rows, rows.row(y), palette), m_sums.size());
+                    if (++m_box_rows == m_scale)
+                        emit_row();
+                }
+            }
+
+            /// Returns the finished thumbnail
+            thumbnail finish()
+            {
+                thumbnail result = std::move(m_thumbnail);
+                m_thumbnail = thumbnail();
+                return result;
+            }
+
+            /// Returns a thumbnail of the whole image **view**
+            thumbnail generate(const image_view& view)
+            {
+                if (view.empty())
+                    return thumbnail();
+                begin_page(view.width, view.height, is_gray(view));
+                add_rows(view);
+                return finish();
+            }
+
+            /// Returns **true** if a page like **view** gets a gray8 thumbnail
+            static bool has_gray_thumbnail(const image_view& view) noexcept { return is_gray(view); }
+        };
+    }
+}
+#endif
@@ -23,6 +23,7 @@ OF THIRD PARTY RIGHTS.
 
 #include <unordered_set>
 #include <dynarithmic/twain/twain_values.hpp>
+#include <dynarithmic/twain/imagehandler/image_view.hpp>
 #include <dynarithmic/twain/source/twain_source_base.hpp>
 
 namespace dynarithmic
@@ -47,12 +48,23 @@ namespace dynarithmic
             private:
                 acquired_strip_data m_stripData;
                 HANDLE m_hStrip;
+                const void* m_pStrip = nullptr;   // m_hStrip, locked for as long as it is allocated
                 LONG m_nStripSize;
                 LONG m_nCurrentStripSize;
                 LONG m_nMinSize, m_nMaxSize, m_nPrefSize;
                 std::unordered_set<compression_value::value_type> all_compression_types;
                 DTWAIN_SOURCE m_twain_source;
             
+                void free_strip()
+                {
+                    if (m_pStrip)
+                        ::GlobalUnlock(m_hStrip);
+                    if (m_hStrip)
+                        API_INSTANCE DTWAIN_FreeMemory(m_hStrip);
+                    m_pStrip = nullptr;
+                    m_hStrip = nullptr;
+                }
+
             public:
                 buffered_transfer_info() : m_hStrip(nullptr), m_nStripSize(0),
                                             m_nMinSize(0), m_nMaxSize(0), m_nPrefSize(0), 
@@ -61,8 +73,7 @@ namespace dynarithmic
 
                 buffered_transfer_info::~buffered_transfer_info()
                 {
-                    if ( m_hStrip )
-                        API_INSTANCE DTWAIN_FreeMemory(m_hStrip);
+                    free_strip();
                 }
 
                 LONG stripsize() const { return m_nStripSize; }
@@ -79,6 +90,17 @@ namespace dynarithmic
                     return m_stripData;
                 }
 
+                /// Returns a view of the rows of the current strip, as described by the last call to get_strip_data().
+                /// @param[in] format The pixel format of the acquisition, since the strip data does not include it.
+                /// @returns an empty view if there is no strip buffer or the strip is compressed.
+                image_view get_strip_view(pixel_format format) const
+                {
+                    if (!m_pStrip || m_stripData.Compression != TWCP_NONE || m_stripData.Rows <= 0)
+                        return {};
+                    // strips are transferred top row first
+                    return image_view::from_rows(m_pStrip, m_stripData.Columns, m_stripData.Rows, m_stripData.BytesPerRow, format);
+                }
+
                 buffered_transfer_info& set_stripsize(long sz) { m_nStripSize = sz; return *this; }
             
                 bool init_transfer(compression_value::value_type compression)
@@ -98,8 +120,7 @@ namespace dynarithmic
                     if (m_nStripSize > 0)
                     {
                         // Allocate memory for strip here
-                        if (m_hStrip)
-                            API_INSTANCE DTWAIN_FreeMemory(m_hStrip);
+                        free_strip();
 
                         m_hStrip = API_INSTANCE DTWAIN_AllocateMemory(m_nStripSize);
                         if (!m_hStrip)
@@ -107,9 +128,10 @@ namespace dynarithmic
 
                         if (!API_INSTANCE DTWAIN_SetAcquireStripBuffer(m_twain_source, m_hStrip))
                         {
-                            API_INSTANCE DTWAIN_FreeMemory(m_hStrip);
+                            free_strip();
                             return false;
                         }
+                        m_pStrip = ::GlobalLock(m_hStrip);
                     }
                     return true;
                 }
@@ -22,6 +22,7 @@ OF THIRD PARTY RIGHTS.
 #define DTWAIN_FILE_TRANSFER_INFO_HPP
 
 #include <unordered_set>
+#include <vector>
 #include <dynarithmic/twain/twain_values.hpp>
 
 // Class that controls the naming of image files when generated
@@ -36,6 +37,13 @@ namespace dynarithmic
                 std::unordered_set<filetype_value::value_type> all_file_types;
             
             public:
+                /// The capabilities that, when set, can change the supported file types
+                static const std::vector<int>& get_dependent_caps()
+                {
+                    static const std::vector<int> dependent_caps = { ICAP_XFERMECH };
+                    return dependent_caps;
+                }
+
                 bool is_supported() const { return !all_file_types.empty(); }
                 bool is_supported(filetype_value::value_type ft) const { return all_file_types.find(ft) != all_file_types.end(); }
         };
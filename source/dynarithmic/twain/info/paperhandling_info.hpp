@@ -22,6 +22,7 @@ OF THIRD PARTY RIGHTS.
 #define DTWAIN_PAPERHANDLING_INFO_HPP
 
 #include <vector>
+#include <algorithm>
 #include <dynarithmic/twain/twain_values.hpp>
 #include <dynarithmic/twain/source/twain_source_base.hpp>
 
@@ -83,48 +84,55 @@ namespace dynarithmic
                 return v.front() ? true : false;
             }
 
+            /// The capabilities that, when set, can change the information returned by get_info()
+            static const std::vector<int>& get_dependent_caps()
+            {
+                static const std::vector<int> dependent_caps = { CAP_AUTOFEED, CAP_CLEARPAGE, CAP_DUPLEXENABLED,
+                                                                 CAP_FEEDERALIGNMENT, CAP_FEEDERENABLED, CAP_FEEDERORDER,
+                                                                 CAP_FEEDERPOCKET, CAP_FEEDERPREP, CAP_FEEDPAGE,
+                                                                 CAP_PAPERHANDLING, CAP_REWINDPAGE, ICAP_FEEDERTYPE };
+                return dependent_caps;
+            }
+
             bool get_info(twain_source_base& ts)
             {
                 *this = {};
                 auto& capInterface = ts.get_capability_interface();
-                m_vAutoFeed = capInterface.get_cap_values<std::vector<CAP_AUTOFEED_::value_type>>(CAP_AUTOFEED);
-                m_vClearPage = capInterface.get_cap_values<std::vector<CAP_CLEARPAGE_::value_type>>(CAP_CLEARPAGE);
-                m_vDuplexEnabled = capInterface.get_cap_values<std::vector<CAP_DUPLEXENABLED_::value_type>>(CAP_DUPLEXENABLED);
-                m_vFeederAlignment = capInterface.get_cap_values<std::vector<CAP_FEEDERALIGNMENT_::value_type>>(CAP_FEEDERALIGNMENT);
-                m_vFeederEnabled = capInterface.get_cap_values<std::vector<CAP_FEEDERENABLED_::value_type>>(CAP_FEEDERENABLED); 
-                m_vFeederOrder = capInterface.get_cap_values<std::vector<CAP_FEEDERORDER_::value_type>>(CAP_FEEDERORDER);
-                m_vFeederLoaded = capInterface.get_cap_values<std::vector<CAP_FEEDERLOADED_::value_type>>(CAP_FEEDERLOADED); 
-                m_vFeederPocket = capInterface.get_cap_values<std::vector<CAP_FEEDERPOCKET_::value_type>>(CAP_FEEDERPOCKET);
-                m_vFeederPrep = capInterface.get_cap_values<std::vector<CAP_FEEDERPREP_::value_type>>(CAP_FEEDERPREP); 
-                m_vFeedPage = capInterface.get_cap_values<std::vector<CAP_FEEDPAGE_::value_type>>(CAP_FEEDPAGE);
-                m_vPaperDetectable = capInterface.get_cap_values<std::vector<CAP_PAPERDETECTABLE_::value_type>>(CAP_PAPERDETECTABLE);
-                m_vPaperHandling = capInterface.get_cap_values<std::vector<CAP_PAPERHANDLING_::value_type>>(CAP_PAPERHANDLING);
-                m_vReacquireAllowed = capInterface.get_cap_values<std::vector<CAP_REACQUIREALLOWED_::value_type>>(CAP_REACQUIREALLOWED); 
-                m_vRewindPage = capInterface.get_cap_values<std::vector<CAP_REWINDPAGE_::value_type>>(CAP_REWINDPAGE);
-                m_vFeederType = capInterface.get_cap_values<std::vector<ICAP_FEEDERTYPE_::value_type>>(ICAP_FEEDERTYPE);
-                if (capInterface.is_cap_supported(CAP_DUPLEX))
-                    m_Duplex = capInterface.get_cap_values<std::vector<CAP_DUPLEX_::value_type>>(CAP_DUPLEX).front();
+
+                // retrieve everything in one batch, so that each capability is queried at most once
+                const auto snapshot = capInterface.get_snapshot({ CAP_AUTOFEED, CAP_CLEARPAGE, CAP_DUPLEXENABLED,
+                                                                  CAP_FEEDERALIGNMENT, CAP_FEEDERENABLED, CAP_FEEDERORDER,
+                                                                  CAP_FEEDERLOADED, CAP_FEEDERPOCKET, CAP_FEEDERPREP,
+                                                                  CAP_FEEDPAGE, CAP_PAPERDETECTABLE, CAP_PAPERHANDLING,
+                                                                  CAP_REACQUIREALLOWED, CAP_REWINDPAGE, ICAP_FEEDERTYPE, CAP_DUPLEX,
+                                                                  { CAP_FEEDERENABLED, get_operation_type::GET_CURRENT } });
+                m_vAutoFeed = snapshot.get_values<CAP_AUTOFEED_>();
+                m_vClearPage = snapshot.get_values<CAP_CLEARPAGE_>();
+                m_vDuplexEnabled = snapshot.get_values<CAP_DUPLEXENABLED_>();
+                m_vFeederAlignment = snapshot.get_values<CAP_FEEDERALIGNMENT_>();
+                m_vFeederEnabled = snapshot.get_values<CAP_FEEDERENABLED_>();
+                m_vFeederOrder = snapshot.get_values<CAP_FEEDERORDER_>();
+                m_vFeederLoaded = snapshot.get_values<CAP_FEEDERLOADED_>();
+                m_vFeederPocket = snapshot.get_values<CAP_FEEDERPOCKET_>();
+                m_vFeederPrep = snapshot.get_values<CAP_FEEDERPREP_>();
+                m_vFeedPage = snapshot.get_values<CAP_FEEDPAGE_>();
+                m_vPaperDetectable = snapshot.get_values<CAP_PAPERDETECTABLE_>();
+                m_vPaperHandling = snapshot.get_values<CAP_PAPERHANDLING_>();
+                m_vReacquireAllowed = snapshot.get_values<CAP_REACQUIREALLOWED_>();
+                m_vRewindPage = snapshot.get_values<CAP_REWINDPAGE_>();
+                m_vFeederType = snapshot.get_values<ICAP_FEEDERTYPE_>();
+                auto vDuplex = snapshot.get_values<CAP_DUPLEX_>();
+                if (!vDuplex.empty())
+                    m_Duplex = vDuplex.front();
+                // The feeder is supported if it is enabled, or if it can be enabled.  This is determined from the values
+                // the device reports, so that the state of the device is not changed.
                 if (!capInterface.is_cap_supported(CAP_FEEDERENABLED))
                     m_bFeederSupported = false;
                 else
                 {
-                    auto tempVal = capInterface.get_cap_values<std::vector<CAP_FEEDERENABLED_::value_type>>(CAP_FEEDERENABLED, capability_interface::get_current());
-                    if (!tempVal.empty())
-                    {
-                        if (tempVal.front() == true)
-                            m_bFeederSupported = true;
-                        else
-                        {
-                            capInterface.set_cap_values<std::vector<CAP_FEEDERENABLED_::value_type >>({ true }, CAP_FEEDERENABLED);
-                            if (capInterface.get_last_error().error_code == DTWAIN_NO_ERROR)
-                            {
-                                capInterface.set_cap_values<std::vector<CAP_FEEDERENABLED_::value_type >>({ tempVal.front() }, CAP_FEEDERENABLED); 
-                                m_bFeederSupported = true;
-                            }
-                            else
-                                m_bFeederSupported = false;
-                        }
-                    }
+                    auto tempVal = snapshot.get_values<CAP_FEEDERENABLED_>(get_operation_type::GET_CURRENT);
+                    m_bFeederSupported = (!tempVal.empty() && tempVal.front()) ||
+                                         std::find(m_vFeederEnabled.begin(), m_vFeederEnabled.end(), true) != m_vFeederEnabled.end();
                 }
                 return true;
             }
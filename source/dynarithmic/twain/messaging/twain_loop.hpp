@@ -21,7 +21,10 @@ OF THIRD PARTY RIGHTS.
 #ifndef DTWAIN_TWAIN_LOOP_HPP
 #define DTWAIN_TWAIN_LOOP_HPP
 
+#include <algorithm>
+#include <thread>
 #include <dynarithmic/twain/source/twain_source_base.hpp>
+#include <dynarithmic/twain/messaging/twain_loop_signal.hpp>
 #include <dtwain.h>
 
 namespace dynarithmic {
@@ -56,12 +59,33 @@ namespace twain {
             if (ts.is_uionlyenabled() && DTWAIN_GetTwainMode() == DTWAIN_MODELESS)
                 ts.set_uionlyenabled(false);
         }
+
+        /// Processes the window messages that are waiting, without blocking.
+        /// @returns **true** if the source is still open and pump_once() should be called again, **false** otherwise.
+        bool pump_once(twain_source_base& ts)
+        {
+            MSG msg;
+            while (twain_loop<twain_looper_win32>::is_source_open(ts) && ::PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+            {
+                if (!DTWAIN_IsTwainMsg(&msg) && m_dispatcher.enter_dispatch(ts))
+                {
+                    ::TranslateMessage(&msg);
+                    ::DispatchMessage(&msg);
+                }
+            }
+            if (twain_loop<twain_looper_win32>::is_source_open(ts))
+                return true;
+            if (ts.is_uionlyenabled() && DTWAIN_GetTwainMode() == DTWAIN_MODELESS)
+                ts.set_uionlyenabled(false);
+            return false;
+        }
     };
 
     // This version should only be used for version 2.x and higher TWAIN Data Source Manager
     template <typename dispatcher = twain_default_enter_dispatch>
     struct twain_looper_nowin32
     {
+        twain_looper_nowin32(twain_source_base&) {}
         dispatcher m_dispatcher;
 
         void perform_loop(twain_source_base& ts)
@@ -74,6 +98,134 @@ namespace twain {
         }
     };
 
+    // This version should only be used for version 2.x and higher TWAIN Data Source Manager.
+    // Instead of polling without pause for as long as the source is open, the loop polls for a short while after each
+    // message, and then blocks on the session's twain_loop_signal for the park interval, which doubles each time a park
+    // ends without TWAIN activity (up to m_maxPark).  A notification that DTWAIN reports on another thread (for example
+    // a TWAIN 2 source's callback) ends the park at once.  Activity that DTWAIN only reports from inside
+    // DTWAIN_IsTwainMsg() cannot end a park, and waits for up to m_maxPark (50 ms by default) before it is processed.
+    // Lower m_maxPark to trade CPU time for latency.
+    template <typename dispatcher = twain_default_enter_dispatch>
+    struct twain_looper_adaptive
+    {
+        using clock_type = twain_loop_signal::clock_type;
+        using duration_type = twain_loop_statistics::duration_type;
+
+        dispatcher m_dispatcher;
+        twain_loop_signal* m_pSignal;   // ends parks early, and receives the statistics of the loop
+        uint32_t m_nSpinPolls = 200;
+        duration_type m_minPark = std::chrono::milliseconds(1);
+        duration_type m_maxPark = std::chrono::milliseconds(50);
+
+        twain_looper_adaptive(twain_source_base& ts) : m_pSignal(ts.get_loop_signal()) {}
+
+        void perform_loop(twain_source_base& ts)
+        {
+            using std::chrono::duration_cast;
+            twain_loop_statistics stats;
+            MSG msg = {};
+            uint32_t idle_polls = 0;
+            duration_type park_interval = m_minPark;
+            const auto loop_start = clock_type::now();
+            auto idle_start = loop_start;
+
+            while (twain_loop<twain_looper_adaptive>::is_source_open(ts))
+            {
+                ++stats.polls;
+                if (DTWAIN_IsTwainMsg(&msg))
+                {
+                    ++stats.messages_processed;
+                    idle_polls = 0;
+                    park_interval = m_minPark;
+                    idle_start = clock_type::now();
+                    continue;
+                }
+
+                if (++idle_polls < m_nSpinPolls)
+                {
+                    if (idle_polls > m_nSpinPolls / 2)
+                        std::this_thread::yield();
+                    continue;
+                }
+
+                // nothing to do for a while, so stop using the CPU
+                const auto park_start = clock_type::now();
+                stats.idle_spin_time += duration_cast<duration_type>(park_start - idle_start);
+                ++stats.parks;
+                const bool notified = park(park_interval);
+                const auto park_end = clock_type::now();
+                stats.parked_time += duration_cast<duration_type>(park_end - park_start);
+                stats.max_park_time = (std::max)(stats.max_park_time, duration_cast<duration_type>(park_end - park_start));
+                if (notified)
+                {
+                    ++stats.notified_wakes;
+                    park_interval = m_minPark;
+                }
+                else
+                    park_interval = (std::min)(park_interval * 2, m_maxPark);
+                idle_polls = 0;
+                idle_start = park_end;
+            }
+
+            stats.total_time = duration_cast<duration_type>(clock_type::now() - loop_start);
+            if (m_pSignal)
+                m_pSignal->set_statistics(stats);
+            finish_loop(ts);
+        }
+
+        #ifdef _WIN32
+        /// Returns a handle that is signalled when pump_once() should be called.
+        ///
+        /// Applications with their own event loop (for example asio or WaitForMultipleObjects) can wait on this handle
+        /// together with their other handles, and call pump_once() each time it is signalled, instead of running
+        /// perform_loop() on a dedicated thread.  The handle is signalled when the session's DTWAIN callback reports
+        /// TWAIN activity, and at least every **poll_period**.
+        /// @returns the handle, or **nullptr** if the source has no twain_session.
+        /// @see twain_loop_signal::get_native_handle()
+        twain_loop_signal::native_handle_type get_readiness_handle(std::chrono::milliseconds poll_period = std::chrono::milliseconds(10))
+        {
+            return m_pSignal ? m_pSignal->get_native_handle(poll_period) : nullptr;
+        }
+        #endif
+
+        /// Processes the TWAIN messages that are waiting, without blocking.
+        /// @returns **true** if the source is still open and pump_once() should be called again, **false** if the
+        /// source has finished, in which case the loop is complete.
+        bool pump_once(twain_source_base& ts)
+        {
+            MSG msg = {};
+            for (uint32_t i = 0; i < m_nSpinPolls && twain_loop<twain_looper_adaptive>::is_source_open(ts); ++i)
+            {
+                if (!DTWAIN_IsTwainMsg(&msg))
+                    break;
+            }
+            if (twain_loop<twain_looper_adaptive>::is_source_open(ts))
+                return true;
+            finish_loop(ts);
+            return false;
+        }
+
+        private:
+            // blocks until TWAIN activity is reported, or **interval** passes
+            // @returns **true** if the park was ended by TWAIN activity
+            bool park(duration_type interval)
+            {
+                if (!m_pSignal)
+                {
+                    std::this_thread::sleep_for(interval);
+                    return false;
+                }
+                twain_loop_signal::clock_type::time_point notify_time;
+                return m_pSignal->wait_for(interval, notify_time);
+            }
+
+            static void finish_loop(twain_source_base& ts)
+            {
+                if (ts.is_uionlyenabled() && DTWAIN_GetTwainMode() == DTWAIN_MODELESS)
+                    ts.set_uionlyenabled(false);
+            }
+    };
+
     template <typename looper>
     class twain_loop
     {
@@ -94,6 +246,7 @@ namespace twain {
         
     typedef twain_loop<twain_looper_win32<>> twain_loop_windows;
     typedef twain_loop<twain_looper_nowin32<>> twain_loop_ver2;
+    typedef twain_loop<twain_looper_adaptive<>> twain_loop_adaptive;
 
 /*    void TwainMessageLoopWindowsImpl::PerformMessageLoop(CTL_ITwainSource* pSource, bool isUIOnly)
     {
@@ -0,0 +1,212 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_LOOP_SIGNAL_HPP
+#define DTWAIN_TWAIN_LOOP_SIGNAL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+namespace dynarithmic {
+namespace twain {
+
+    /// Statistics gathered by a message loop while a source was open
+    struct twain_loop_statistics
+    {
+        using duration_type = std::chrono::microseconds;
+
+        uint64_t polls = 0;                 ///< number of times the TWAIN message queue was checked
+        uint64_t messages_processed = 0;    ///< number of polls that processed a TWAIN message
+        uint64_t parks = 0;                 ///< number of times the loop blocked because there were no messages
+        uint64_t notified_wakes = 0;        ///< number of parks ended early by TWAIN activity
+        duration_type total_time{ 0 };      ///< wall-clock time spent in the loop
+        duration_type parked_time{ 0 };     ///< wall-clock time spent blocked, not using the CPU
+        duration_type idle_spin_time{ 0 };  ///< wall-clock time spent polling with no message to process
+        duration_type max_park_time{ 0 };   ///< the longest park
+
+        /// Returns the fraction of the loop's wall-clock time spent polling while there was nothing to do.  This is not a
+        /// measurement of CPU time: a polling thread that the system does not schedule is still counted.
+        double get_idle_spin_fraction() const noexcept
+        {
+            if (total_time.count() == 0)
+                return 0.0;
+            return static_cast<double>(idle_spin_time.count()) / static_cast<double>(total_time.count());
+        }
+    };
+
+    /// Counts the TWAIN activity that DTWAIN reports for a twain_session, and wakes threads that wait for it.
+    ///
+    /// The twain_session notifies its signal from the DTWAIN callback, for every notification.  When DTWAIN calls the
+    /// callback on another thread (for example, from a TWAIN 2 source's callback), the notification wakes a message loop
+    /// that is blocked in wait_for().  When DTWAIN calls it from inside DTWAIN_IsTwainMsg(), on the thread that runs the
+    /// loop, it tells other threads, and the loop after each pump, that activity was processed.  A notification that
+    /// arrives before a thread waits is not lost.
+    ///
+    /// notify() only takes a lock when a thread is waiting, so that the callback stays cheap while the loop is polling.
+    ///
+    /// On Windows, get_native_handle() returns a waitable timer that applications with their own event loop can wait
+    /// on, and call twain_looper_adaptive::pump_once() when it is signalled.
+    class twain_loop_signal
+    {
+        public:
+            using clock_type = std::chrono::steady_clock;
+            #ifdef _WIN32
+            using native_handle_type = HANDLE;
+            #endif
+
+        private:
+            mutable std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::atomic<uint64_t> m_nPending{ 0 };
+            std::atomic<uint32_t> m_nWaiters{ 0 };
+            std::atomic<clock_type::rep> m_nLastNotify{ 0 };
+            twain_loop_statistics m_statistics;
+            #ifdef _WIN32
+            std::atomic<HANDLE> m_hTimer{ nullptr };
+            LONG m_nPollPeriod = 0;
+
+            // signals the timer now, and then every poll period
+            void arm_timer(HANDLE hTimer, LONGLONG due_time)
+            {
+                LARGE_INTEGER due;
+                due.QuadPart = due_time;
+                ::SetWaitableTimer(hTimer, &due, m_nPollPeriod, nullptr, nullptr, FALSE);
+            }
+            #endif
+
+        public:
+            twain_loop_signal() = default;
+            twain_loop_signal(const twain_loop_signal&) = delete;
+            twain_loop_signal& operator=(const twain_loop_signal&) = delete;
+
+            ~twain_loop_signal()
+            {
+                #ifdef _WIN32
+                if (HANDLE hTimer = m_hTimer.load())
+                    ::CloseHandle(hTimer);
+                #endif
+            }
+
+            /// Signals that there is TWAIN activity to be processed
+            void notify()
+            {
+                m_nLastNotify.store(clock_type::now().time_since_epoch().count(), std::memory_order_relaxed);
+                // a waiter registers before it checks m_nPending, so either it sees this notification, or it is seen here
+                m_nPending.fetch_add(1);
+                if (m_nWaiters.load() > 0)
+                {
+                    // taking the lock makes sure that the waiter is either before its check or blocked
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_condition.notify_all();
+                }
+                #ifdef _WIN32
+                if (HANDLE hTimer = m_hTimer.load(std::memory_order_acquire))
+                    arm_timer(hTimer, -1);
+                #endif
+            }
+
+            #ifdef _WIN32
+            /// Returns a waitable timer that is signalled when the DTWAIN callback reports TWAIN activity, and otherwise
+            /// every **poll_period**.  The timer is created on first use.
+            ///
+            /// DTWAIN reports the activity of a source that posts its TWAIN messages to the application's message queue
+            /// only once the message has been passed to DTWAIN_IsTwainMsg(), so the poll period bounds the delay before
+            /// such a message is processed.  Activity that DTWAIN reports on another thread signals the timer at once.
+            /// The timer is a synchronization timer: a successful wait resets it.
+            /// @param[in] poll_period The longest time between two signals.  Only used when the timer is created.
+            /// @returns the timer, or **nullptr** if it could not be created.
+            /// @note The handle is owned by the twain_loop_signal and must not be closed by the caller.
+            native_handle_type get_native_handle(std::chrono::milliseconds poll_period = std::chrono::milliseconds(10))
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                HANDLE hTimer = m_hTimer.load();
+                if (!hTimer)
+                {
+                    hTimer = ::CreateWaitableTimer(nullptr, FALSE, nullptr);
+                    if (!hTimer)
+                        return nullptr;
+                    m_nPollPeriod = (std::max)(static_cast<LONG>(poll_period.count()), 1L);
+                    // a notification that arrived before the timer existed makes it signalled at once
+                    arm_timer(hTimer, m_nPending.load() > 0 ? -1 : -10000LL * m_nPollPeriod);
+                    m_hTimer.store(hTimer, std::memory_order_release);
+                }
+                return hTimer;
+            }
+            #endif
+
+            /// Consumes any pending notification without waiting.
+            /// @returns **true** if there was a pending notification, **false** otherwise.
+            bool try_consume()
+            {
+                return m_nPending.exchange(0) != 0;
+            }
+
+            /// Waits up to **timeout** for a notification.
+            /// @returns **true** and the time of the most recent notification in **notify_time** if a notification was
+            /// received, **false** if the wait timed out.
+            template <typename Rep, typename Period>
+            bool wait_for(const std::chrono::duration<Rep, Period>& timeout, clock_type::time_point& notify_time)
+            {
+                if (m_nPending.load() == 0)
+                {
+                    m_nWaiters.fetch_add(1);
+                    bool notified;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        notified = m_condition.wait_for(lock, timeout, [&] { return m_nPending.load() > 0; });
+                    }
+                    m_nWaiters.fetch_sub(1);
+                    if (!notified)
+                        return false;
+                }
+                m_nPending.store(0);
+                notify_time = clock_type::time_point(clock_type::duration(m_nLastNotify.load(std::memory_order_relaxed)));
+                return true;
+            }
+
+            /// Discards any notifications that have not been waited on
+            void reset()
+            {
+                m_nPending.store(0);
+            }
+
+            /// Returns the statistics of the most recent message loop that used this signal
+            twain_loop_statistics get_statistics() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_statistics;
+            }
+
+            void set_statistics(const twain_loop_statistics& stats)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_statistics = stats;
+            }
+    };
+}
+}
+#endif
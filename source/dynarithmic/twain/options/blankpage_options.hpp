@@ -25,6 +25,7 @@ OF THIRD PARTY RIGHTS.
 #include <iterator>
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <dynarithmic/twain/twain_values.hpp>
 
 namespace dynarithmic
@@ -39,14 +40,26 @@ namespace dynarithmic
             discard_all_after_resampling =  DTWAIN_BP_AUTODISCARD_AFTERPROCESS
         };
 
+        enum class blankpage_detection_method
+        {
+            dtwain,         ///< DTWAIN's blank page detection (DTWAIN_SetBlankPageDetection)
+            vectorized      ///< blank_page_detector, which runs on each page as it arrives, and records a score for each page
+        };
+
          class blankpage_options
          {
              public:
                  static constexpr double default_blank_page_threshold = 98.0;
+                 static constexpr double default_margin = 2.0;
+                 static constexpr unsigned char default_ink_level = 128;
              private:
                  bool m_bEnabled;
                  double m_threshold = default_blank_page_threshold;
                  blankpage_discard_option discard_option;
+                 blankpage_detection_method m_method = blankpage_detection_method::dtwain;
+                 double m_margin = default_margin;
+                 uint32_t m_noise_tolerance = 0;
+                 unsigned char m_ink_level = default_ink_level;
 
              public:
                  using blankpage_detection_info = std::pair<bool, double>;
@@ -57,6 +70,16 @@ namespace dynarithmic
                  bool is_enabled() const { return m_bEnabled; }
                  double get_threshold() const { return m_threshold; }
                  blankpage_discard_option get_discard_option() const { return discard_option; }
+
+                 // the following settings only apply to blankpage_detection_method::vectorized
+                 blankpage_options& set_detection_method(blankpage_detection_method method) { m_method = method; return *this; }
+                 blankpage_options& set_margin(double percent) { m_margin = percent; return *this; }
+                 blankpage_options& set_noise_tolerance(uint32_t pixels_per_row) { m_noise_tolerance = pixels_per_row; return *this; }
+                 blankpage_options& set_ink_level(unsigned char level) { m_ink_level = level; return *this; }
+                 blankpage_detection_method get_detection_method() const { return m_method; }
+                 double get_margin() const { return m_margin; }
+                 uint32_t get_noise_tolerance() const { return m_noise_tolerance; }
+                 unsigned char get_ink_level() const { return m_ink_level; }
          };
     }
 }
@@ -0,0 +1,84 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_COLORDETECTION_OPTIONS_HPP
+#define DTWAIN_COLORDETECTION_OPTIONS_HPP
+
+#include <cstdint>
+#include <dynarithmic/twain/twain_values.hpp>
+#include <dynarithmic/twain/imagehandler/color_detector.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        enum class colordetection_mode
+        {
+            off,
+            classify,   ///< each page is classified as bitonal, gray or color, and a file type is suggested for it
+            reduce      ///< as classify, and bitonal and gray pages acquired in color to memory are converted to 1 or 8 bits per pixel.
+                        ///< Pages of file transfers are only classified.
+        };
+
+        /// The classification of a page, and the pixel type and file type that store it most cheaply
+        struct page_color_info
+        {
+            color_analysis analysis;
+            uint16_t bits_per_pixel = 0;                    ///< bits per pixel of the page as acquired
+            uint16_t stored_bits_per_pixel = 0;             ///< bits per pixel after colordetection_mode::reduce
+            filetype_value::value_type suggested_file_type = filetype_value::jpeg;
+            bool reduced = false;                           ///< **true** if the page was converted and its memory block shrunk
+        };
+
+         class colordetection_options
+         {
+             public:
+                 static constexpr unsigned char default_bitonal_threshold = 128;
+             private:
+                 colordetection_mode m_mode = colordetection_mode::off;
+                 unsigned char m_chroma_tolerance = color_detector::default_chroma_tolerance;
+                 double m_color_threshold = color_detector::default_color_threshold;
+                 double m_midtone_threshold = color_detector::default_midtone_threshold;
+                 unsigned char m_bitonal_threshold = default_bitonal_threshold;
+                 filetype_value::value_type m_file_types[3] = { filetype_value::tiffgroup4, filetype_value::jpeg, filetype_value::jpeg };
+
+             public:
+                 colordetection_options& set_mode(colordetection_mode mode) { m_mode = mode; return *this; }
+                 colordetection_options& set_chroma_tolerance(unsigned char tolerance) { m_chroma_tolerance = tolerance; return *this; }
+                 colordetection_options& set_color_threshold(double percent) { m_color_threshold = percent; return *this; }
+                 colordetection_options& set_midtone_threshold(double percent) { m_midtone_threshold = percent; return *this; }
+                 colordetection_options& set_bitonal_threshold(unsigned char level) { m_bitonal_threshold = level; return *this; }
+
+                 /// Sets the file type suggested for pages of class **cls**.  The defaults are tiffgroup4 for bitonal
+                 /// pages and jpeg for gray and color pages.
+                 colordetection_options& set_file_type(color_class cls, filetype_value::value_type file_type)
+                 { m_file_types[static_cast<int>(cls)] = file_type; return *this; }
+
+                 colordetection_mode get_mode() const { return m_mode; }
+                 bool is_enabled() const { return m_mode != colordetection_mode::off; }
+                 unsigned char get_chroma_tolerance() const { return m_chroma_tolerance; }
+                 double get_color_threshold() const { return m_color_threshold; }
+                 double get_midtone_threshold() const { return m_midtone_threshold; }
+                 unsigned char get_bitonal_threshold() const { return m_bitonal_threshold; }
+                 filetype_value::value_type get_file_type(color_class cls) const { return m_file_types[static_cast<int>(cls)]; }
+         };
+    }
+}
+#endif
@@ -0,0 +1,57 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_DESKEW_OPTIONS_HPP
+#define DTWAIN_DESKEW_OPTIONS_HPP
+
+#include <dynarithmic/twain/imagehandler/page_deskew.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Options for deskewing pages in software, for devices that do not support ICAP_AUTOMATICDESKEW.
+        /// Pages are only deskewed in software if the device does not report ICAP_AUTOMATICDESKEW as supported;
+        /// otherwise set the capability with autoadjust_options instead.
+         class deskew_options
+         {
+             public:
+                 static constexpr double default_min_angle = 0.1;
+             private:
+                 bool m_bEnabled = false;
+                 double m_max_angle = skew_estimator::default_max_angle;
+                 double m_min_angle = default_min_angle;
+                 bool m_bVerify = false;
+
+             public:
+                 deskew_options& enable(bool bEnable) { m_bEnabled = bEnable; return *this; }
+                 deskew_options& set_max_angle(double degrees) { m_max_angle = degrees; return *this; }
+                 deskew_options& set_min_angle(double degrees) { m_min_angle = degrees; return *this; }
+
+                 /// Measures the skew of each rotated page again, and reports it as deskew_result::residual_angle
+                 deskew_options& set_verify(bool bVerify) { m_bVerify = bVerify; return *this; }
+                 bool is_enabled() const { return m_bEnabled; }
+                 double get_max_angle() const { return m_max_angle; }
+                 double get_min_angle() const { return m_min_angle; }
+                 bool get_verify() const { return m_bVerify; }
+         };
+    }
+}
+#endif
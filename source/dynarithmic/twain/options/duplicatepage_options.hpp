@@ -0,0 +1,57 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_DUPLICATEPAGE_OPTIONS_HPP
+#define DTWAIN_DUPLICATEPAGE_OPTIONS_HPP
+
+#include <cstddef>
+#include <dynarithmic/twain/imagehandler/duplicate_page_detector.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        enum class duplicatepage_action
+        {
+            flag,       ///< duplicates are kept, and reported by twain_source::get_duplicate_pages()
+            discard     ///< duplicates are discarded as they arrive, and reported by twain_source::get_duplicate_pages()
+        };
+
+         class duplicatepage_options
+         {
+             private:
+                 bool m_bEnabled = false;
+                 duplicatepage_action m_action = duplicatepage_action::flag;
+                 size_t m_window = duplicate_page_detector::default_window;
+                 int m_max_distance = duplicate_page_detector::default_max_distance;
+
+             public:
+                 duplicatepage_options& enable(bool bEnable) { m_bEnabled = bEnable; return *this; }
+                 duplicatepage_options& set_action(duplicatepage_action action) { m_action = action; return *this; }
+                 duplicatepage_options& set_window(size_t pages) { m_window = pages; return *this; }
+                 duplicatepage_options& set_max_distance(int distance) { m_max_distance = distance; return *this; }
+                 bool is_enabled() const { return m_bEnabled; }
+                 duplicatepage_action get_action() const { return m_action; }
+                 size_t get_window() const { return m_window; }
+                 int get_max_distance() const { return m_max_distance; }
+         };
+    }
+}
+#endif
@@ -0,0 +1,479 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_ACTOR_HPP
+#define DTWAIN_TWAIN_ACTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <dynarithmic/twain/source/twain_source.hpp>
+#include <dynarithmic/twain/types/twain_mpsc_queue.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Owns a twain_session on a dedicated thread, and executes commands sent to it from any thread.
+        ///
+        /// All TWAIN calls must be made from a single thread.  The twain_actor is that thread: it starts the TWAIN session,
+        /// opens the source, and runs the message loop.  Other threads send commands through a lock-free queue, and
+        /// receive the results through std::future objects.
+        ///
+        /// Commands that are queued together are executed as a batch between message loop iterations:
+        /// <ul>
+        ///   <li>consecutive capability set commands are applied back to back, and the monitored capability state is
+        ///       published once for the whole group, if any of the sets succeeded,</li>
+        ///   <li>consecutive capability queries are merged into one capability_snapshot, so that each capability is
+        ///       retrieved from the device at most once.</li>
+        /// </ul>
+        class twain_actor
+        {
+            public:
+                using clock_type = std::chrono::steady_clock;
+
+                struct actor_metrics
+                {
+                    size_t queue_depth = 0;
+                    size_t max_queue_depth = 0;
+                    uint64_t commands_executed = 0;
+                    uint64_t batches_executed = 0;
+                    uint64_t capability_commands_batched = 0;
+                    std::chrono::microseconds average_queue_latency{ 0 };
+                    std::chrono::microseconds max_queue_latency{ 0 };
+                    std::chrono::microseconds average_execution_time{ 0 };
+                };
+
+            private:
+                enum class command_kind { capability_set, capability_query, general };
+
+                struct command
+                {
+                    command_kind kind;
+                    clock_type::time_point queued_time;
+                    explicit command(command_kind k) : kind(k), queued_time(clock_type::now()) {}
+                    virtual ~command() {}
+                };
+
+                struct set_command : command
+                {
+                    capability_setting setting;
+                    std::promise<capability_interface::cap_return_type> promise;
+                    explicit set_command(capability_setting&& s) : command(command_kind::capability_set), setting(std::move(s)) {}
+                };
+
+                struct query_command : command
+                {
+                    std::vector<capability_query> queries;
+                    std::promise<capability_snapshot> promise;
+                    explicit query_command(std::vector<capability_query>&& q) : command(command_kind::capability_query), queries(std::move(q)) {}
+                };
+
+                struct general_command : command
+                {
+                    std::function<void(twain_actor&)> fn;
+                    explicit general_command(std::function<void(twain_actor&)>&& f) : command(command_kind::general), fn(std::move(f)) {}
+                };
+
+                using command_ptr = std::unique_ptr<command>;
+
+                twain_characteristics m_characteristics;
+                std::chrono::milliseconds m_idleInterval;
+                twain_mpsc_queue<command_ptr> m_queue;
+                std::unique_ptr<twain_session> m_pSession;
+                std::unique_ptr<twain_source> m_pSource;
+                std::promise<bool> m_startPromise;
+                std::thread m_thread;
+
+                // used only to put the actor thread to sleep when there is nothing to do.  Commands are never
+                // queued or dequeued under this lock.
+                std::mutex m_wakeMutex;
+                std::condition_variable m_wakeCondition;
+                std::atomic<bool> m_bSleeping;
+                std::atomic<bool> m_bStop;
+                std::atomic<bool> m_bStarted;
+
+                std::atomic<size_t> m_nQueueDepth;
+                std::atomic<size_t> m_nMaxQueueDepth;
+                std::atomic<uint64_t> m_nCommandsExecuted;
+                std::atomic<uint64_t> m_nBatchesExecuted;
+                std::atomic<uint64_t> m_nCapabilityCommandsBatched;
+                std::atomic<uint64_t> m_nTotalQueueLatency;
+                std::atomic<uint64_t> m_nMaxQueueLatency;
+                std::atomic<uint64_t> m_nTotalExecutionTime;
+
+                static constexpr size_t max_batch_size = 256;
+
+                template <typename R, typename Fn>
+                static void fulfil(std::promise<R>& promise, Fn& fn, twain_actor& actor)
+                {
+                    promise.set_value(fn(actor));
+                }
+
+                template <typename Fn>
+                static void fulfil(std::promise<void>& promise, Fn& fn, twain_actor& actor)
+                {
+                    fn(actor);
+                    promise.set_value();
+                }
+
+                void enqueue(command_ptr pCommand)
+                {
+                    // count the command before it can be popped, so that the worker's decrement never precedes this increment
+                    const size_t depth = m_nQueueDepth.fetch_add(1) + 1;
+                    m_queue.push(std::move(pCommand));
+                    size_t max_depth = m_nMaxQueueDepth.load(std::memory_order_relaxed);
+                    while (depth > max_depth && !m_nMaxQueueDepth.compare_exchange_weak(max_depth, depth, std::memory_order_relaxed))
+                        ;
+                    if (m_bSleeping.load())
+                    {
+                        std::lock_guard<std::mutex> lock(m_wakeMutex);
+                        m_wakeCondition.notify_one();
+                    }
+                }
+
+                template <typename R, typename Fn>
+                std::future<R> enqueue_general(Fn fn)
+                {
+                    auto pPromise = std::make_shared<std::promise<R>>();
+                    auto fut = pPromise->get_future();
+                    enqueue(std::make_unique<general_command>([pPromise, fn](twain_actor& actor) mutable
+                    {
+                        try
+                        {
+                            fulfil(*pPromise, fn, actor);
+                        }
+                        catch (...)
+                        {
+                            pPromise->set_exception(std::current_exception());
+                        }
+                    }));
+                    return fut;
+                }
+
+                static void pump_messages()
+                {
+                    MSG msg;
+                    while (::PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+                    {
+                        if (!API_INSTANCE DTWAIN_IsTwainMsg(&msg))
+                        {
+                            ::TranslateMessage(&msg);
+                            ::DispatchMessage(&msg);
+                        }
+                    }
+                }
+
+                void wait_for_commands()
+                {
+                    std::unique_lock<std::mutex> lock(m_wakeMutex);
+                    m_bSleeping.store(true);
+                    m_wakeCondition.wait_for(lock, m_idleInterval, [&] { return m_nQueueDepth.load() > 0 || m_bStop.load(); });
+                    m_bSleeping.store(false);
+                }
+
+                void record_latency(const command& cmd, clock_type::time_point start, clock_type::time_point end)
+                {
+                    using std::chrono::duration_cast;
+                    using std::chrono::microseconds;
+                    const auto queued = static_cast<uint64_t>(duration_cast<microseconds>(start - cmd.queued_time).count());
+                    m_nTotalQueueLatency.fetch_add(queued, std::memory_order_relaxed);
+                    m_nTotalExecutionTime.fetch_add(static_cast<uint64_t>(duration_cast<microseconds>(end - start).count()),
+                                                    std::memory_order_relaxed);
+                    uint64_t max_latency = m_nMaxQueueLatency.load(std::memory_order_relaxed);
+                    while (queued > max_latency && !m_nMaxQueueLatency.compare_exchange_weak(max_latency, queued, std::memory_order_relaxed))
+                        ;
+                    m_nCommandsExecuted.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void execute_sets(std::vector<command_ptr>::iterator first, std::vector<command_ptr>::iterator last)
+                {
+                    const auto start = clock_type::now();
+                    if (m_pSource)
+                    {
+                        // the monitored state is published once, when the last set of the group has been made
+                        twain_source::publish_deferral deferral(m_pSource.get());
+                        for (auto it = first; it != last; ++it)
+                        {
+                            auto& cmd = static_cast<set_command&>(**it);
+                            capability_interface::cap_return_type ret = { false, DTWAIN_ERR_BAD_SOURCE };
+                            if (m_pSource->is_open())
+                                ret = m_pSource->get_capability_interface().apply_setting(cmd.setting);
+                            cmd.promise.set_value(ret);
+                        }
+                    }
+                    else
+                    {
+                        for (auto it = first; it != last; ++it)
+                            static_cast<set_command&>(**it).promise.set_value({ false, DTWAIN_ERR_BAD_SOURCE });
+                    }
+                    const auto end = clock_type::now();
+                    for (auto it = first; it != last; ++it)
+                        record_latency(**it, start, end);
+                    m_nCapabilityCommandsBatched.fetch_add(static_cast<uint64_t>(last - first), std::memory_order_relaxed);
+                }
+
+                void execute_queries(std::vector<command_ptr>::iterator first, std::vector<command_ptr>::iterator last)
+                {
+                    const auto start = clock_type::now();
+                    std::vector<capability_query> all_queries;
+                    for (auto it = first; it != last; ++it)
+                    {
+                        auto& queries = static_cast<query_command&>(**it).queries;
+                        all_queries.insert(all_queries.end(), queries.begin(), queries.end());
+                    }
+                    capability_snapshot snapshot;
+                    if (m_pSource && m_pSource->is_open())
+                        snapshot = m_pSource->get_capability_interface().get_snapshot(std::move(all_queries));
+
+                    // give each command the part of the merged snapshot that it asked for
+                    for (auto it = first; it != last; ++it)
+                    {
+                        auto& cmd = static_cast<query_command&>(**it);
+                        capability_snapshot::entry_map entries;
+                        size_t driver_calls = 0;
+                        size_t cache_hits = 0;
+                        for (auto& q : cmd.queries)
+                        {
+                            auto iter = snapshot.get_entries().find(q);
+                            if (iter != snapshot.get_entries().end() && entries.insert(*iter).second)
+                            {
+                                // counted from where each entry actually came from
+                                driver_calls += iter->second.from_device ? 1 : 0;
+                                cache_hits += iter->second.from_cache ? 1 : 0;
+                            }
+                        }
+                        cmd.promise.set_value(capability_snapshot(std::move(entries), cmd.queries.size(),
+                                                                  driver_calls, cache_hits));
+                    }
+                    const auto end = clock_type::now();
+                    for (auto it = first; it != last; ++it)
+                        record_latency(**it, start, end);
+                    m_nCapabilityCommandsBatched.fetch_add(static_cast<uint64_t>(last - first), std::memory_order_relaxed);
+                }
+
+                void execute_batch(std::vector<command_ptr>& batch)
+                {
+                    auto it = batch.begin();
+                    while (it != batch.end())
+                    {
+                        const auto kind = (*it)->kind;
+                        if (kind == command_kind::general)
+                        {
+                            const auto start = clock_type::now();
+                            static_cast<general_command&>(**it).fn(*this);
+                            record_latency(**it, start, clock_type::now());
+                            ++it;
+                            continue;
+                        }
+
+                        // group consecutive capability commands of the same kind
+                        auto last = std::find_if(it, batch.end(), [&](const command_ptr& p) { return p->kind != kind; });
+                        if (kind == command_kind::capability_set)
+                            execute_sets(it, last);
+                        else
+                            execute_queries(it, last);
+                        it = last;
+                    }
+                    m_nBatchesExecuted.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void run()
+                {
+                    m_pSession = std::make_unique<twain_session>();
+                    m_pSession->get_twain_characteristics() = m_characteristics;
+                    m_bStarted.store(m_pSession->start());
+                    m_startPromise.set_value(m_bStarted.load());
+
+                    std::vector<command_ptr> batch;
+                    while (!m_bStop.load() || m_nQueueDepth.load() > 0)
+                    {
+                        // take everything that is queued, so that capability commands can be grouped
+                        command_ptr pCommand;
+                        while (batch.size() < max_batch_size && m_queue.try_pop(pCommand))
+                        {
+                            m_nQueueDepth.fetch_sub(1);
+                            batch.push_back(std::move(pCommand));
+                        }
+
+                        if (!batch.empty())
+                        {
+                            execute_batch(batch);
+                            batch.clear();
+                        }
+                        pump_messages();
+                        if (m_nQueueDepth.load() == 0 && !m_bStop.load())
+                            wait_for_commands();
+                    }
+                    m_pSource.reset();
+                    m_pSession.reset();
+                }
+
+            public:
+                /// Starts the actor thread, which starts a twain_session using **tc**.
+                /// @param[in] tc The characteristics of the twain_session
+                /// @param[in] idle_interval How often the message loop is run when there are no commands to execute
+                explicit twain_actor(const twain_characteristics& tc = twain_characteristics(),
+                                     std::chrono::milliseconds idle_interval = std::chrono::milliseconds(10)) :
+                                     m_characteristics(tc), m_idleInterval(idle_interval), m_bSleeping(false), m_bStop(false), m_bStarted(false),
+                                     m_nQueueDepth(0), m_nMaxQueueDepth(0), m_nCommandsExecuted(0), m_nBatchesExecuted(0),
+                                     m_nCapabilityCommandsBatched(0), m_nTotalQueueLatency(0), m_nMaxQueueLatency(0),
+                                     m_nTotalExecutionTime(0)
+                {
+                    auto started = m_startPromise.get_future();
+                    m_thread = std::thread([this] { run(); });
+                    started.wait();
+                }
+
+                twain_actor(const twain_actor&) = delete;
+                twain_actor& operator=(const twain_actor&) = delete;
+
+                /// Executes the commands that are still queued, closes the source and stops the twain_session
+                ~twain_actor()
+                {
+                    m_bStop.store(true);
+                    {
+                        std::lock_guard<std::mutex> lock(m_wakeMutex);
+                        m_wakeCondition.notify_one();
+                    }
+                    if (m_thread.joinable())
+                        m_thread.join();
+                }
+
+                /// Returns **true** if the twain_session was started
+                bool started() const noexcept { return m_bStarted.load(); }
+
+                /// Selects and opens a source.  If **product_name** is empty, the default source is opened.
+                std::future<bool> open(std::string product_name = std::string())
+                {
+                    return enqueue_general<bool>([product_name](twain_actor& actor)
+                    {
+                        actor.m_pSource.reset();
+                        if (!actor.m_pSession || !actor.m_pSession->started())
+                            return false;
+                        if (product_name.empty())
+                            actor.m_pSource = std::make_unique<twain_source>(actor.m_pSession->select_source(select_default(), false));
+                        else
+                            actor.m_pSource = std::make_unique<twain_source>(actor.m_pSession->select_source(select_byname(product_name), false));
+                        return actor.m_pSource->is_selected() && actor.m_pSource->open();
+                    });
+                }
+
+                /// Closes the open source
+                std::future<bool> close()
+                {
+                    return enqueue_general<bool>([](twain_actor& actor)
+                    {
+                        const bool closed = actor.m_pSource && actor.m_pSource->close();
+                        actor.m_pSource.reset();
+                        return closed;
+                    });
+                }
+
+                /// Replaces the acquire_characteristics of the open source.  The capabilities are set on the next acquire().
+                std::future<bool> apply(acquire_characteristics ac)
+                {
+                    return enqueue_general<bool>([ac](twain_actor& actor)
+                    {
+                        if (!actor.m_pSource || !actor.m_pSource->is_open())
+                            return false;
+                        actor.m_pSource->set_acquire_characteristics(ac);
+                        return true;
+                    });
+                }
+
+                /// Sets a capability on the open source
+                std::future<capability_interface::cap_return_type> set_capability(capability_setting setting)
+                {
+                    auto pCommand = std::make_unique<set_command>(std::move(setting));
+                    auto fut = pCommand->promise.get_future();
+                    enqueue(std::move(pCommand));
+                    return fut;
+                }
+
+                /// Retrieves capability values from the open source.
+                ///
+                /// Queries that are waiting together are merged into one capability_snapshot.  The device call and cache
+                /// hit counts of the returned snapshot describe the entries of this query, so an entry that another query
+                /// of the same batch also asked for is counted in both.
+                std::future<capability_snapshot> query(std::vector<capability_query> queries)
+                {
+                    auto pCommand = std::make_unique<query_command>(std::move(queries));
+                    auto fut = pCommand->promise.get_future();
+                    enqueue(std::move(pCommand));
+                    return fut;
+                }
+
+                /// Acquires images from the open source, using its acquire_characteristics
+                std::future<twain_source::acquire_return_type> acquire()
+                {
+                    return enqueue_general<twain_source::acquire_return_type>([](twain_actor& actor)
+                    {
+                        if (!actor.m_pSource || !actor.m_pSource->is_open())
+                            return twain_source::acquire_return_type{ DTWAIN_ERR_BAD_SOURCE, twain_array() };
+                        return actor.m_pSource->acquire();
+                    });
+                }
+
+                /// Executes **fn** on the actor thread.  **fn** is called with the twain_session and the open source, which
+                /// is **nullptr** if no source is open.
+                template <typename Fn>
+                auto execute(Fn fn) -> std::future<decltype(fn(std::declval<twain_session&>(), std::declval<twain_source*>()))>
+                {
+                    using result_type = decltype(fn(std::declval<twain_session&>(), std::declval<twain_source*>()));
+                    return enqueue_general<result_type>([fn](twain_actor& actor) mutable
+                    {
+                        return fn(*actor.m_pSession, actor.m_pSource.get());
+                    });
+                }
+
+                /// Returns the number of commands waiting to be executed
+                size_t get_queue_depth() const noexcept { return m_nQueueDepth.load(); }
+
+                actor_metrics get_metrics() const
+                {
+                    using std::chrono::microseconds;
+                    actor_metrics metrics;
+                    metrics.queue_depth = m_nQueueDepth.load();
+                    metrics.max_queue_depth = m_nMaxQueueDepth.load();
+                    metrics.commands_executed = m_nCommandsExecuted.load();
+                    metrics.batches_executed = m_nBatchesExecuted.load();
+                    metrics.capability_commands_batched = m_nCapabilityCommandsBatched.load();
+                    metrics.max_queue_latency = microseconds(m_nMaxQueueLatency.load());
+                    if (metrics.commands_executed > 0)
+                    {
+                        metrics.average_queue_latency = microseconds(m_nTotalQueueLatency.load() / metrics.commands_executed);
+                        metrics.average_execution_time = microseconds(m_nTotalExecutionTime.load() / metrics.commands_executed);
+                    }
+                    return metrics;
+                }
+        };
+    }
+}
+#endif
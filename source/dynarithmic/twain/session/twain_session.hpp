@@ -86,6 +86,13 @@ namespace dynarithmic
             auto thisObject = reinterpret_cast<twain_session_base*>(UserData);
             if (thisObject)
             {
+                thisObject->get_loop_signal().notify();
+                bool filtered = false;
+                for (auto& filter : thisObject->get_notification_filters())
+                {
+                    if (filter.hook(wParam, lParam) == 0)
+                        filtered = true;
+                }
                 std::for_each(thisObject->get_callback_map().begin(),
                     thisObject->get_callback_map().end(),
                     [&](twain_session_base::callback_map_type::value_type& vt)
@@ -93,6 +100,13 @@ namespace dynarithmic
                     retVal = static_cast<LRESULT>(vt.second->call_func(wParam, lParam, vt.first));
                 }
                 );
+                for (auto& hook : thisObject->get_notification_hooks())
+                {
+                    if (hook.second(wParam, lParam) == 0)
+                        retVal = 0;
+                }
+                if (filtered)
+                    retVal = 0;
             }
             return retVal;
         }
@@ -315,8 +329,11 @@ namespace dynarithmic
                     m_bStarted = rhs.m_bStarted;
                     m_Handle = rhs.m_Handle;
                     m_mapcallback = std::move(rhs.m_mapcallback);
+                    m_notification_hooks = std::move(rhs.m_notification_hooks);
+                    m_notification_filters = std::move(rhs.m_notification_filters);
                     m_logger_callback = std::move(rhs.m_logger_callback);
                     m_source_cache = std::move(rhs.m_source_cache);
+                    std::swap(m_loop_signal, rhs.m_loop_signal);
                     API_INSTANCE DTWAIN_SetCallback64(dynarithmic::twain::callback_proc, reinterpret_cast<DTWAIN_LONG64>(this));
                     API_INSTANCE DTWAIN_SetErrorCallback64(dynarithmic::twain::error_callback_proc, reinterpret_cast<DTWAIN_LONG64>(this));
                     rhs.m_Handle = nullptr;
@@ -21,6 +21,8 @@ OF THIRD PARTY RIGHTS.
 #ifndef DTWAIN_TWAIN_SESSION_BASE_HPP
 #define DTWAIN_TWAIN_SESSION_BASE_HPP
 
+#include <algorithm>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -28,6 +30,7 @@ OF THIRD PARTY RIGHTS.
 
 #include <dynarithmic/twain/characteristics/twain_characteristics.hpp>
 #include <dynarithmic/twain/identity/twain_identity.hpp>
+#include <dynarithmic/twain/messaging/twain_loop_signal.hpp>
 
 namespace dynarithmic {
 namespace twain {
@@ -36,6 +39,56 @@ namespace twain {
     class twain_listener;
     class error_logger;
 
+    /// The stages of the notification filters, in the order in which each notification reaches them.  Filters that
+    /// change a page come first, so that the filters that only examine it see the page that is kept.
+    enum class notification_stage
+    {
+        deskew,     ///< rotates the page
+        reduce,     ///< reduces the pixel depth of the page
+        analyze     ///< examines the page without changing it
+    };
+
+    /// The notification filters of a session, called in order of their stage, and in the order they were installed
+    /// within a stage.
+    class notification_filter_list
+    {
+        public:
+            using notification_hook = std::function<LRESULT(WPARAM, LPARAM)>;
+            struct filter
+            {
+                const void* key;
+                notification_stage stage;
+                notification_hook hook;
+            };
+            using container_type = std::vector<filter>;
+
+        private:
+            container_type m_filters;
+
+        public:
+            /// Installs **hook** in **stage**, keyed by the object that installs it.  A filter with the same key is replaced.
+            void install(const void* key, notification_stage stage, notification_hook hook)
+            {
+                erase(key);
+                auto pos = std::upper_bound(m_filters.begin(), m_filters.end(), stage,
+                                            [](notification_stage s, const filter& f) { return s < f.stage; });
+                m_filters.insert(pos, { key, stage, std::move(hook) });
+            }
+
+            void erase(const void* key)
+            {
+                m_filters.erase(std::remove_if(m_filters.begin(), m_filters.end(), [&](const filter& f) { return f.key == key; }),
+                                m_filters.end());
+            }
+
+            bool empty() const noexcept { return m_filters.empty(); }
+            size_t size() const noexcept { return m_filters.size(); }
+            container_type::iterator begin() noexcept { return m_filters.begin(); }
+            container_type::iterator end() noexcept { return m_filters.end(); }
+            container_type::const_iterator begin() const noexcept { return m_filters.begin(); }
+            container_type::const_iterator end() const noexcept { return m_filters.end(); }
+    };
+
     /**
     The twain_session_base class serves as the base class to twain_session.
     */
@@ -45,6 +98,8 @@ namespace twain {
             using source_basic_info = twain_app_info;
             using logger_callback_type = std::pair<twain_session_base*, std::unique_ptr<twain_logger>>;
             using callback_map_type = std::unordered_map<twain_source*, std::unique_ptr<twain_listener>>;
+            using notification_hook = std::function<LRESULT(WPARAM, LPARAM)>;
+            using notification_hook_map = std::unordered_map<const void*, notification_hook>;
 
         protected:
             bool m_bStarted = false;
@@ -56,7 +111,10 @@ namespace twain {
             DTWAIN_HANDLE m_Handle = nullptr;
             logger_callback_type m_logger_callback;
             callback_map_type m_mapcallback;
+            notification_hook_map m_notification_hooks;
+            notification_filter_list m_notification_filters;
             mutable std::vector<source_basic_info> m_source_cache;
+            std::shared_ptr<twain_loop_signal> m_loop_signal = std::make_shared<twain_loop_signal>();
 
         public:
             twain_session_base() = default;
@@ -69,6 +127,21 @@ namespace twain {
             twain_characteristics& get_twain_characteristics() noexcept { return m_twain_characteristics; }
 
             callback_map_type& get_callback_map() noexcept { return m_mapcallback; }
+
+            /// Returns the internal notification hooks, which are called for every DTWAIN notification after the
+            /// registered twain_listener objects.  Each hook is keyed by the object that installed it.  If a hook
+            /// returns 0, the notification returns 0 to DTWAIN.
+            notification_hook_map& get_notification_hooks() noexcept { return m_notification_hooks; }
+
+            /// Returns the internal notification filters, which are called like the notification hooks, but before the
+            /// registered twain_listener objects and the hooks, and in the order of their notification_stage.
+            notification_filter_list& get_notification_filters() noexcept { return m_notification_filters; }
+
+            /// Returns the signal that is notified whenever DTWAIN reports TWAIN activity for this session
+            ///
+            /// The signal is notified on the thread that runs the message loop, while it processes the activity, so it
+            /// can wake other threads but not a parked message loop.
+            twain_loop_signal& get_loop_signal() noexcept { return *m_loop_signal; }
             virtual void log_error(LONG msg) {}
     };
 }
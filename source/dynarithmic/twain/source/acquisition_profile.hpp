@@ -0,0 +1,229 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_ACQUISITION_PROFILE_HPP
+#define DTWAIN_ACQUISITION_PROFILE_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <unordered_set>
+#include <dynarithmic/twain/source/twain_source.hpp>
+#include <dynarithmic/twain/capability_interface/capability_constraints.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// An acquisition_profile is an acquire_characteristics compiled into a plan of capability settings for one device.
+        ///
+        /// The plan is built once by compile(), which
+        /// <ul>
+        ///   <li>records the capability settings the acquire_characteristics would make, keeping only the capabilities that
+        ///       the device supports,</li>
+        ///   <li>removes duplicate settings of the same capability, keeping the last one,</li>
+        ///   <li>validates each value against the values and ranges that the device reports, dropping the ones the device
+        ///       would not accept.</li>
+        /// </ul>
+        /// The plan can be saved and loaded, so that later runs apply it directly with apply(), with no validation and no
+        /// queries to the device.  A plan is only applied to the device it was compiled for, and only while the
+        /// acquire_characteristics are the ones it was compiled from: otherwise it must be compiled again.
+        class acquisition_profile
+        {
+            public:
+                struct apply_step
+                {
+                    capability_setting setting;
+                    LONG data_type = TWTY_INT16;
+                };
+
+            private:
+                static constexpr const char* profile_header = "twain-acquisition-profile";
+                static constexpr int profile_version = 1;
+
+                std::string m_productName;
+                uint64_t m_fingerprint = 0;
+                std::vector<apply_step> m_steps;
+                std::vector<int> m_rejectedCaps;
+                std::vector<int> m_failedCaps;
+
+                static void write_string(std::ostream& strm, const std::string& s)
+                {
+                    strm << " " << s.size() << ":" << s;
+                }
+
+                static bool read_string(std::istream& strm, std::string& s)
+                {
+                    size_t len = 0;
+                    char sep = 0;
+                    if (!(strm >> len) || !strm.get(sep) || sep != ':')
+                        return false;
+                    s.resize(len);
+                    if (len > 0 && !strm.read(&s[0], static_cast<std::streamsize>(len)))
+                        return false;
+                    return true;
+                }
+
+            public:
+                /// Compiles the current acquire_characteristics of **ts** into an acquisition_profile for the device.
+                /// @note The device is queried for its supported values, so the twain_source must be open.
+                static acquisition_profile compile(twain_source& ts)
+                {
+                    acquisition_profile profile;
+                    profile.m_productName = ts.get_source_info().get_product_name();
+
+                    auto settings = ts.get_capability_settings();
+                    profile.m_fingerprint = capability_fingerprint(settings);
+
+                    // keep the last setting made for each supported capability, in the order that the last settings were made
+                    auto& ci = ts.get_capability_interface();
+                    std::unordered_set<int> seen;
+                    std::vector<capability_setting> unique_settings;
+                    for (auto it = settings.rbegin(); it != settings.rend(); ++it)
+                    {
+                        if (seen.insert(it->cap_value).second && ci.is_cap_supported(it->cap_value))
+                            unique_settings.push_back(std::move(*it));
+                    }
+                    std::reverse(unique_settings.begin(), unique_settings.end());
+
+                    // validate the values against the device's supported values in one batch
+                    std::vector<int> caps;
+                    for (auto& s : unique_settings)
+                        caps.push_back(s.cap_value);
+                    const auto constraints = capability_constraint_set::build(ci, profile.m_productName, caps);
+
+                    for (auto& s : unique_settings)
+                    {
+                        if (constraints.validate(s) == validation_status::value_not_supported)
+                        {
+                            profile.m_rejectedCaps.push_back(s.cap_value);
+                            continue;
+                        }
+                        apply_step step;
+                        step.data_type = ci.get_cap_data_type(s.cap_value);
+                        step.setting = std::move(s);
+                        profile.m_steps.push_back(std::move(step));
+                    }
+                    return profile;
+                }
+
+                /// Returns **true** if the plan was compiled for the device that **ts** represents, from the
+                /// acquire_characteristics that **ts** currently has.
+                /// @note The device is not contacted.
+                bool is_current(twain_source& ts) const
+                {
+                    return ts.is_open() && ts.get_source_info().get_product_name() == m_productName &&
+                           ts.get_characteristics_fingerprint() == m_fingerprint;
+                }
+
+                /// Applies the compiled plan to **ts**.
+                ///
+                /// @returns **false**, without setting any capability, if the plan is not current for **ts** (see is_current()).
+                /// @note If every setting is accepted by the device, the next twain_source::acquire() will not set the
+                /// capabilities again.  The capabilities whose settings failed are returned by get_failed_caps().
+                bool apply(twain_source& ts)
+                {
+                    m_failedCaps.clear();
+                    if (!is_current(ts))
+                        return false;
+                    auto& ci = ts.get_capability_interface();
+                    for (auto& step : m_steps)
+                    {
+                        if (!ci.apply_setting(step.setting, step.data_type).return_value)
+                            m_failedCaps.push_back(step.setting.cap_value);
+                    }
+                    if (m_failedCaps.empty())
+                        ts.mark_caps_applied(m_fingerprint);
+                    return true;
+                }
+
+                bool save(std::ostream& strm) const
+                {
+                    strm << profile_header << " " << profile_version << "\n";
+                    strm << "product";
+                    write_string(strm, m_productName);
+                    strm << "\nfingerprint " << m_fingerprint << "\n";
+                    strm << "steps " << m_steps.size() << "\n";
+                    for (auto& step : m_steps)
+                    {
+                        const auto& s = step.setting;
+                        strm << s.cap_value << " " << s.operation << " " << step.data_type << " ";
+                        s.values.write(strm);
+                        strm << "\n";
+                    }
+                    return strm.good();
+                }
+
+                bool load(std::istream& strm)
+                {
+                    acquisition_profile profile;
+                    std::string token;
+                    int version = 0;
+                    size_t num_steps = 0;
+                    if (!(strm >> token) || token != profile_header || !(strm >> version) || version != profile_version)
+                        return false;
+                    if (!(strm >> token) || token != "product")
+                        return false;
+                    strm.get();
+                    if (!read_string(strm, profile.m_productName))
+                        return false;
+                    if (!(strm >> token >> profile.m_fingerprint) || token != "fingerprint")
+                        return false;
+                    if (!(strm >> token >> num_steps) || token != "steps")
+                        return false;
+                    for (size_t i = 0; i < num_steps; ++i)
+                    {
+                        apply_step step;
+                        auto& s = step.setting;
+                        if (!(strm >> s.cap_value >> s.operation >> step.data_type) || !s.values.read(strm))
+                            return false;
+                        profile.m_steps.push_back(std::move(step));
+                    }
+                    *this = std::move(profile);
+                    return true;
+                }
+
+                bool save(const std::string& filename) const
+                {
+                    std::ofstream ofs(filename);
+                    return ofs && save(ofs);
+                }
+
+                bool load(const std::string& filename)
+                {
+                    std::ifstream ifs(filename);
+                    return ifs && load(ifs);
+                }
+
+                const std::string& get_product_name() const noexcept { return m_productName; }
+                uint64_t get_fingerprint() const noexcept { return m_fingerprint; }
+                const std::vector<apply_step>& get_steps() const noexcept { return m_steps; }
+
+                /// Capabilities that were removed from the plan because the device does not accept the requested value
+                const std::vector<int>& get_rejected_caps() const noexcept { return m_rejectedCaps; }
+
+                /// Capabilities whose settings the device did not accept in the last apply()
+                const std::vector<int>& get_failed_caps() const noexcept { return m_failedCaps; }
+        };
+    }
+}
+#endif
@@ -0,0 +1,115 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_APPLIED_SETTINGS_CACHE_HPP
+#define DTWAIN_APPLIED_SETTINGS_CACHE_HPP
+
+#include <array>
+#include <string>
+#include <cstdint>
+#include <dynarithmic/twain/capability_interface/capability_snapshot.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// The non-capability settings that a twain_source applies before each acquisition
+        enum class applied_setting
+        {
+            acquire_area,
+            job_control,
+            manual_duplex,
+            image_negative,
+            blank_page_detection,
+            multipage_scan_mode,
+            max_acquisitions,
+            pdf_creator,
+            pdf_title,
+            pdf_producer,
+            pdf_author,
+            pdf_subject,
+            pdf_keywords,
+            pdf_ascii_compression,
+            pdf_orientation,
+            pdf_page_size,
+            pdf_page_scale,
+            pdf_encryption,
+            num_settings
+        };
+
+        /// Remembers the values last applied for each applied_setting, so that a DTWAIN call that would apply the same
+        /// values again can be skipped.
+        class applied_settings_cache
+        {
+            struct applied_value
+            {
+                bool is_applied = false;
+                uint64_t value_hash = 0;
+            };
+
+            std::array<applied_value, static_cast<size_t>(applied_setting::num_settings)> m_applied;
+            uint64_t m_nIssued = 0;
+            uint64_t m_nElided = 0;
+
+            static void add_values(capability_hasher&) {}
+
+            template <typename T, typename... Rest>
+            static void add_values(capability_hasher& hasher, const T& value, const Rest&... rest)
+            {
+                hasher.add_value(value);
+                add_values(hasher, rest...);
+            }
+
+            public:
+                /// Returns **true** if the setting has to be applied, because it has not been applied yet, or was applied
+                /// with different values.  If **true** is returned, the values are remembered as applied.
+                template <typename... Values>
+                bool needs_apply(applied_setting setting, const Values&... values)
+                {
+                    capability_hasher hasher;
+                    add_values(hasher, values...);
+                    auto& applied = m_applied[static_cast<size_t>(setting)];
+                    if (applied.is_applied && applied.value_hash == hasher.value)
+                    {
+                        ++m_nElided;
+                        return false;
+                    }
+                    applied.is_applied = true;
+                    applied.value_hash = hasher.value;
+                    ++m_nIssued;
+                    return true;
+                }
+
+                /// Forgets the applied values, so that every setting is applied again.  This is done when the source is
+                /// opened or closed.
+                void clear() noexcept
+                {
+                    m_applied.fill(applied_value());
+                }
+
+                /// Returns the number of DTWAIN calls that were skipped because the values had already been applied
+                uint64_t get_elided_count() const noexcept { return m_nElided; }
+
+                /// Returns the number of settings that were applied
+                uint64_t get_issued_count() const noexcept { return m_nIssued; }
+        };
+    }
+}
+#endif
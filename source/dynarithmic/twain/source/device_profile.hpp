@@ -0,0 +1,180 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_DEVICE_PROFILE_HPP
+#define DTWAIN_DEVICE_PROFILE_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <dynarithmic/twain/source/twain_source.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A named snapshot of a device's state, stored as the device's custom data (CAP_CUSTOMDSDATA) together with a
+        /// fingerprint of the acquire_characteristics that produced that state.
+        class device_profile
+        {
+            std::string m_name;
+            uint64_t m_fingerprint = 0;
+            std::vector<unsigned char> m_customData;
+
+            public:
+                device_profile() = default;
+                device_profile(std::string name, uint64_t fingerprint, std::vector<unsigned char> data) :
+                                m_name(std::move(name)), m_fingerprint(fingerprint), m_customData(std::move(data)) {}
+
+                const std::string& get_name() const noexcept { return m_name; }
+                uint64_t get_fingerprint() const noexcept { return m_fingerprint; }
+                const std::vector<unsigned char>& get_custom_data() const noexcept { return m_customData; }
+        };
+
+        enum class profile_apply_result
+        {
+            applied_custom_data,    // the device state was restored with a single custom data set
+            applied_capabilities,   // each capability was set individually
+            failed
+        };
+
+        /// Manages named device_profile objects for a twain_source.
+        ///
+        /// Switching to a known profile whose fingerprint matches the source's acquire_characteristics restores the device
+        /// state with one CAP_CUSTOMDSDATA set, instead of setting each capability individually.  If the profile is unknown,
+        /// is out of date, or the device rejects the custom data, the capabilities are set individually, and the next
+        /// twain_source::acquire() does not set them again.
+        /// \code {.cpp}
+        ///   device_profile_manager profiles;
+        ///   source.get_acquire_characteristics().get_color_options().set_gamma(2.2);
+        ///   profiles.switch_to(source, "gamma22");  // first time -- capabilities are set individually, profile is stored
+        ///   ...
+        ///   profiles.switch_to(source, "gamma22");  // later -- one custom data set
+        ///   source.acquire();
+        /// \endcode
+        class device_profile_manager
+        {
+            public:
+                struct profile_stats
+                {
+                    uint64_t custom_data_applies = 0;
+                    uint64_t capability_applies = 0;
+                    uint64_t custom_data_rejected = 0;
+                };
+
+            private:
+                std::map<std::string, device_profile> m_profiles;
+                profile_stats m_stats;
+
+                bool capture(twain_source& ts, const std::string& name, uint64_t fingerprint)
+                {
+                    if (!ts.get_capability_interface().is_customdsdata_supported())
+                        return false;
+                    auto data = ts.get_custom_data();
+                    if (data.empty())
+                        return false;
+                    m_profiles[name] = device_profile(name, fingerprint, std::move(data));
+                    return true;
+                }
+
+            public:
+                /// Applies the current acquire_characteristics of **ts** to the device, and stores the resulting device state
+                /// under **name**.
+                ///
+                /// @returns **true** if the device supports CAP_CUSTOMDSDATA and the profile was stored, **false** otherwise.
+                bool save_profile(twain_source& ts, const std::string& name)
+                {
+                    if (!ts.is_open())
+                        return false;
+                    const auto fingerprint = ts.get_characteristics_fingerprint();
+                    ts.start_apply();
+                    ts.mark_caps_applied(fingerprint);
+                    return capture(ts, name, fingerprint);
+                }
+
+                /// Places the device in the state described by the current acquire_characteristics of **ts**, using the
+                /// profile **name** if possible.
+                ///
+                /// @returns profile_apply_result describing how the device state was set
+                profile_apply_result switch_to(twain_source& ts, const std::string& name)
+                {
+                    if (!ts.is_open())
+                        return profile_apply_result::failed;
+
+                    // the fingerprint only records the settings, so computing it does not contact the device
+                    const auto fingerprint = ts.get_characteristics_fingerprint();
+                    auto iter = m_profiles.find(name);
+                    if (iter != m_profiles.end() && iter->second.get_fingerprint() == fingerprint)
+                    {
+                        if (ts.set_custom_data(iter->second.get_custom_data()))
+                        {
+                            // the device state was replaced, so cached values and applied settings are out of date
+                            ts.invalidate_device_state();
+                            ts.mark_caps_applied(fingerprint);
+                            ++m_stats.custom_data_applies;
+                            return profile_apply_result::applied_custom_data;
+                        }
+
+                        // device did not accept the data, so do not try it again
+                        ++m_stats.custom_data_rejected;
+                        m_profiles.erase(iter);
+                        ts.start_apply();
+                        ts.mark_caps_applied(fingerprint);
+                        ++m_stats.capability_applies;
+                        return profile_apply_result::applied_capabilities;
+                    }
+
+                    // unknown or out of date profile.  Set each capability, and store the new state for next time.
+                    ts.start_apply();
+                    ts.mark_caps_applied(fingerprint);
+                    ++m_stats.capability_applies;
+                    capture(ts, name, fingerprint);
+                    return profile_apply_result::applied_capabilities;
+                }
+
+                /// Replaces the acquire_characteristics of **ts** with **ac**, and then calls switch_to(ts, name)
+                profile_apply_result switch_to(twain_source& ts, const std::string& name, const acquire_characteristics& ac)
+                {
+                    ts.set_acquire_characteristics(ac);
+                    return switch_to(ts, name);
+                }
+
+                bool has_profile(const std::string& name) const { return m_profiles.find(name) != m_profiles.end(); }
+                bool remove_profile(const std::string& name) { return m_profiles.erase(name) > 0; }
+                void clear() { m_profiles.clear(); }
+
+                const device_profile* get_profile(const std::string& name) const
+                {
+                    auto iter = m_profiles.find(name);
+                    return iter != m_profiles.end() ? &iter->second : nullptr;
+                }
+
+                void add_profile(device_profile profile)
+                {
+                    auto name = profile.get_name();
+                    m_profiles[name] = std::move(profile);
+                }
+
+                const profile_stats& get_stats() const noexcept { return m_stats; }
+        };
+    }
+}
+#endif
@@ -0,0 +1,228 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_MEMORY_BUDGET_HPP
+#define DTWAIN_MEMORY_BUDGET_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <dtwain.h>
+#include <dynarithmic/twain/types/twain_global_memory.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        struct memory_budget_stats
+        {
+            size_t limit = 0;               ///< the budget in bytes, 0 if there is no limit
+            size_t bytes_in_use = 0;        ///< bytes currently held by acquired pages and transfer buffers
+            size_t peak_bytes = 0;          ///< the largest value of bytes_in_use
+            size_t buffers_held = 0;        ///< number of pages and transfer buffers currently held
+            size_t peak_buffers = 0;
+            uint64_t pauses = 0;            ///< number of times the transfer of a page was held back
+            uint64_t pause_timeouts = 0;    ///< number of pauses that ended without enough memory being released
+            uint64_t unconsumed_pauses = 0; ///< number of times the budget was exhausted with no consumer registered to release memory
+            std::chrono::milliseconds total_pause_time{ 0 };
+        };
+
+        /// Accounts for the memory held by pages acquired to memory, and holds back the device when a limit is reached.
+        ///
+        /// Each page (DIB) and buffered transfer strip is charged when the device transfers it, and released when the
+        /// application frees it with release(), or when the page is spilled to disk or compressed (and charged again
+        /// when it is restored).  When the bytes in use reach the limit, the next page is not transferred until enough
+        /// memory is released by a consumer, or the pause timeout expires.  The device is kept waiting at the
+        /// transfer-ready handshake during the pause, so that it stops feeding paper.
+        ///
+        /// All functions may be called from any thread.
+        /// @note The pause happens on the thread that runs the TWAIN message loop, so only another thread can end it.  A
+        /// thread that releases pages while the acquisition runs registers itself with a consumer_scope.  While no consumer
+        /// is registered, an exhausted budget is only counted (memory_budget_stats::unconsumed_pauses), and the device is
+        /// not held back.
+        class memory_budget
+        {
+            public:
+                enum class timeout_action { continue_acquire, cancel_acquire };
+
+            private:
+                mutable std::mutex m_mutex;
+                std::condition_variable m_released;
+                std::unordered_map<const void*, size_t> m_buffers;
+                memory_budget_stats m_stats;
+                std::chrono::milliseconds m_pauseTimeout{ 5000 };
+                size_t m_nConsumers = 0;
+                timeout_action m_timeoutAction = timeout_action::continue_acquire;
+
+            public:
+                /// Registers the calling thread as a consumer of the budget for its lifetime.  A consumer is a thread that
+                /// releases pages while the acquisition is running, so that a pause can end early.
+                class consumer_scope
+                {
+                    memory_budget* m_pBudget;
+                    public:
+                        explicit consumer_scope(memory_budget& budget) : m_pBudget(&budget) { budget.add_consumer(); }
+                        consumer_scope(const consumer_scope&) = delete;
+                        consumer_scope& operator=(const consumer_scope&) = delete;
+                        ~consumer_scope() { m_pBudget->remove_consumer(); }
+                };
+
+                /// Registers a consumer.  Prefer consumer_scope, which removes the consumer when it goes out of scope.
+                void add_consumer()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    ++m_nConsumers;
+                }
+
+                /// Removes a consumer registered with add_consumer().  A pause ends when its last consumer is removed.
+                void remove_consumer()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (m_nConsumers > 0)
+                            --m_nConsumers;
+                    }
+                    m_released.notify_all();
+                }
+
+                /// Sets the budget in bytes.  A limit of 0 turns off the budget.
+                memory_budget& set_limit(size_t bytes)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_stats.limit = bytes;
+                    }
+                    m_released.notify_all();
+                    return *this;
+                }
+
+                /// Sets how long a page transfer is held back waiting for memory to be released, and what to do if the wait times out
+                memory_budget& set_pause_timeout(std::chrono::milliseconds timeout, timeout_action action = timeout_action::continue_acquire)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_pauseTimeout = timeout;
+                    m_timeoutAction = action;
+                    return *this;
+                }
+
+                size_t get_limit() const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_stats.limit;
+                }
+
+                bool is_enabled() const { return get_limit() != 0; }
+
+                /// Charges **bytes** to the buffer identified by **key**.  Charging a buffer that is already held does nothing.
+                void charge(const void* key, size_t bytes)
+                {
+                    if (!key)
+                        return;
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_buffers.insert({ key, bytes }).second)
+                        return;
+                    m_stats.bytes_in_use += bytes;
+                    ++m_stats.buffers_held;
+                    m_stats.peak_bytes = (std::max)(m_stats.peak_bytes, m_stats.bytes_in_use);
+                    m_stats.peak_buffers = (std::max)(m_stats.peak_buffers, m_stats.buffers_held);
+                }
+
+                /// Charges the size of the image **hDib** (a page acquired to memory)
+                void charge_image(HANDLE hDib)
+                {
+                    if (hDib)
+                        charge(hDib, twain_global_memory::size(hDib));
+                }
+
+                /// Releases the buffer identified by **key** (for example, a page's HANDLE after it has been freed or stored elsewhere).
+                /// @returns **true** if the buffer was charged to this budget, **false** otherwise.
+                bool release(const void* key)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        auto iter = m_buffers.find(key);
+                        if (iter == m_buffers.end())
+                            return false;
+                        m_stats.bytes_in_use -= iter->second;
+                        --m_stats.buffers_held;
+                        m_buffers.erase(iter);
+                    }
+                    m_released.notify_all();
+                    return true;
+                }
+
+                /// Releases every buffer charged to the budget
+                void release_all()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_buffers.clear();
+                        m_stats.bytes_in_use = 0;
+                        m_stats.buffers_held = 0;
+                    }
+                    m_released.notify_all();
+                }
+
+                /// Waits until the bytes in use are below the limit, or the pause timeout expires.  Returns at once if no
+                /// consumer is registered, since nothing could release memory during the wait.
+                /// @returns **false** if the wait timed out and the acquisition should be cancelled, **true** otherwise.
+                bool wait_for_capacity()
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    auto has_capacity = [&] { return m_stats.limit == 0 || m_stats.bytes_in_use < m_stats.limit; };
+                    if (has_capacity())
+                        return true;
+                    if (m_nConsumers == 0)
+                    {
+                        ++m_stats.unconsumed_pauses;
+                        return true;
+                    }
+                    ++m_stats.pauses;
+                    const auto start = std::chrono::steady_clock::now();
+                    const bool released = m_released.wait_for(lock, m_pauseTimeout, [&] { return has_capacity() || m_nConsumers == 0; });
+                    m_stats.total_pause_time += std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                    if (released)
+                        return true;
+                    ++m_stats.pause_timeouts;
+                    return m_timeoutAction == timeout_action::continue_acquire;
+                }
+
+                memory_budget_stats get_stats() const
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return m_stats;
+                }
+
+                /// Resets the peak and pause statistics to the current usage
+                void reset_stats()
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stats.peak_bytes = m_stats.bytes_in_use;
+                    m_stats.peak_buffers = m_stats.buffers_held;
+                    m_stats.pauses = m_stats.pause_timeouts = m_stats.unconsumed_pauses = 0;
+                    m_stats.total_pause_time = std::chrono::milliseconds(0);
+                }
+        };
+    }
+}
+#endif
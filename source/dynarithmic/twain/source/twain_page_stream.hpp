@@ -0,0 +1,385 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_PAGE_STREAM_HPP
+#define DTWAIN_TWAIN_PAGE_STREAM_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <thread>
+#ifdef __has_include
+    #if __has_include(<version>)
+        #include <version>
+    #endif
+#endif
+#if defined(__cpp_lib_generator)
+    #include <generator>
+#endif
+#include <dynarithmic/twain/messaging/twain_loop.hpp>
+#include <dynarithmic/twain/source/twain_source.hpp>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Acquires from a twain_source and returns each page as soon as it has been transferred.
+        ///
+        /// The twain_page_stream is an alternative to acquire() followed by get_images(), and to handling pages in a
+        /// twain_listener.  The acquisition is started in modeless mode on the first call to next() (or begin()), and the
+        /// TWAIN messages are pumped only while the application is waiting for the next page, so at most the pages
+        /// transferred during one pump are held by the stream.
+        /// \code {.cpp}
+        ///     twain_page_stream pages(source);
+        ///     for (auto& page : pages)
+        ///     {
+        ///         process(page.image);
+        ///         if (enough_pages())
+        ///         {
+        ///             pages.cancel();
+        ///             break;
+        ///         }
+        ///     }
+        /// \endcode
+        /// @note The HANDLE of each returned page is owned by the caller, and is no longer tracked by the source's spill or
+        /// compression store.  It must be released from the source's memory_budget if one is in use.  Pages that are transferred but never returned (for example, after cancel())
+        /// are freed and released by the twain_page_stream.  While the budget is exhausted, the next page is held back
+        /// until a thread registered as a memory_budget::consumer_scope releases pages; a caller that frees each page
+        /// itself before asking for the next one needs no consumer.
+        /// @note The stream must be used on the thread that owns the twain_session.
+        class twain_page_stream
+        {
+            public:
+                struct acquired_page
+                {
+                    HANDLE image = nullptr;         ///< The page's DIB, or **nullptr** if the page was saved to a file
+                    size_t page_number = 0;         ///< The 1-based page number within the stream
+                    bool is_file() const noexcept { return image == nullptr; }
+
+                    /// Returns a view of the page's pixels, without copying them.  The page is locked until the view is destroyed.
+                    locked_image_view get_view() const { return image_handler::get_image_view(image); }
+                };
+
+                /// Input iterator that pulls the next page from the stream when incremented
+                class iterator
+                {
+                    twain_page_stream* m_pStream = nullptr;
+                    acquired_page m_page;
+
+                    void advance()
+                    {
+                        if (m_pStream && !m_pStream->next(m_page))
+                            m_pStream = nullptr;
+                    }
+
+                    public:
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = acquired_page;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = const acquired_page*;
+                        using reference = const acquired_page&;
+
+                        iterator() = default;
+                        explicit iterator(twain_page_stream* pStream) : m_pStream(pStream) { advance(); }
+                        reference operator*() const noexcept { return m_page; }
+                        pointer operator->() const noexcept { return &m_page; }
+                        iterator& operator++() { advance(); return *this; }
+                        bool operator==(const iterator& rhs) const noexcept { return m_pStream == rhs.m_pStream; }
+                        bool operator!=(const iterator& rhs) const noexcept { return m_pStream != rhs.m_pStream; }
+                };
+
+            private:
+                twain_source* m_pSource;
+                #ifdef _WIN32
+                // dispatches the window messages of the source's user interface, as well as the TWAIN messages
+                using looper_type = twain_looper_win32<>;
+                #else
+                using looper_type = twain_looper_adaptive<>;
+                #endif
+                looper_type m_looper;
+                std::deque<acquired_page> m_pages;
+                std::chrono::milliseconds m_waitInterval;
+                size_t m_nPageCount = 0;
+                int32_t m_nAcquireStatus = twain_source::acquire_canceled;
+
+                // DTWAIN fills the acquisition array while the modeless acquisition runs, so it is kept until finish()
+                twain_source::acquire_return_type m_acquireResult;
+                bool m_bStarted = false;
+                bool m_bFinished = false;
+                bool m_bCancelled = false;
+                bool m_bFileTransfer = false;
+                bool m_bOldCustomLoop = false;
+                bool m_bBudgetChecked = false;
+
+                twain_session* get_session() const noexcept { return m_pSource->m_pSession; }
+
+                LRESULT on_notification(WPARAM wParam, LPARAM lParam)
+                {
+                    if (!twain_source::is_from_source(lParam, m_pSource->get_source()))
+                        return 1;
+                    switch (static_cast<LONG>(wParam))
+                    {
+                        // returning 0 stops the device from transferring any more pages
+                        case DTWAIN_TN_TRANSFERREADY:
+                        case DTWAIN_TN_PAGECONTINUE:
+                            return m_bCancelled ? 0 : 1;
+
+                        case DTWAIN_TN_TRANSFERDONE:
+                            if (!m_bFileTransfer)
+                                add_page(m_pSource->get_current_image());
+                        break;
+
+                        case DTWAIN_TN_FILEPAGESAVEOK:
+                            add_page(nullptr);
+                        break;
+                    }
+                    return 1;
+                }
+
+                void add_page(HANDLE image)
+                {
+                    acquired_page page;
+                    page.image = image;
+                    page.page_number = ++m_nPageCount;
+                    m_pages.push_back(page);
+                    m_bBudgetChecked = false;
+                }
+
+                void start()
+                {
+                    if (m_bStarted)
+                        return;
+                    m_bStarted = true;
+                    twain_session* pSession = get_session();
+                    if (!pSession || !m_pSource->is_open())
+                    {
+                        m_bFinished = true;
+                        return;
+                    }
+
+                    const auto transtype = m_pSource->get_acquire_characteristics().get_general_options().get_transfer_type();
+                    m_bFileTransfer = transtype == transfer_type::file_using_native ||
+                                      transtype == transfer_type::file_using_buffered ||
+                                      transtype == transfer_type::file_using_source;
+
+                    // the pages are retrieved by pumping the TWAIN messages here, so the acquisition must be modeless
+                    auto& tc = pSession->get_twain_characteristics();
+                    m_bOldCustomLoop = tc.is_custom_twain_loop();
+                    tc.set_custom_twain_loop(true);
+                    m_pSource->m_bStreamed = true;
+                    pSession->get_notification_hooks()[this] = [this](WPARAM wParam, LPARAM lParam)
+                                                                        { return on_notification(wParam, lParam); };
+                    pSession->get_loop_signal().reset();
+
+                    m_acquireResult = m_pSource->acquire();
+                    m_nAcquireStatus = m_acquireResult.first;
+                    if (m_nAcquireStatus != twain_source::acquire_ok)
+                        finish();
+                }
+
+                void finish()
+                {
+                    if (m_bFinished)
+                        return;
+                    m_bFinished = true;
+                    // the acquisition was modeless, so its hooks were left installed when it started
+                    m_pSource->remove_acquisition_hooks();
+                    m_pSource->m_bStreamed = false;
+                    m_acquireResult.second.reset();
+                    twain_session* pSession = get_session();
+                    if (!pSession)
+                        return;
+                    pSession->get_notification_hooks().erase(this);
+                    pSession->get_twain_characteristics().set_custom_twain_loop(m_bOldCustomLoop);
+                }
+
+                // pumps the TWAIN messages until a page arrives or the acquisition ends
+                void fill()
+                {
+                    start();
+                    while (m_pages.empty() && !m_bFinished)
+                    {
+                        // The memory budget is waited for here, once for each page, rather than in the TWAIN callback.
+                        // The TWAIN messages are not pumped during the wait, so the device is held back all the same.
+                        if (!m_bBudgetChecked)
+                        {
+                            m_bBudgetChecked = true;
+                            if (!m_pSource->get_memory_budget().wait_for_capacity())
+                                m_bCancelled = true;
+                        }
+                        if (!m_looper.pump_once(*m_pSource))
+                            finish();
+                        else if (m_pages.empty())
+                            wait_for_messages();
+                    }
+                }
+
+                // blocks until a message arrives, or the wait interval expires
+                void wait_for_messages()
+                {
+                    #ifdef _WIN32
+                    ::MsgWaitForMultipleObjects(0, nullptr, FALSE, static_cast<DWORD>(m_waitInterval.count()), QS_ALLINPUT);
+                    #else
+                    twain_session* pSession = get_session();
+                    twain_loop_signal::clock_type::time_point notify_time;
+                    if (pSession)
+                        pSession->get_loop_signal().wait_for(m_waitInterval, notify_time);
+                    else
+                        std::this_thread::sleep_for(m_waitInterval);
+                    #endif
+                }
+
+                // removes a page from DTWAIN's acquisition array, so that the array no longer refers to a page that has been
+                // handed to the caller or freed
+                void remove_from_acquisition(HANDLE image)
+                {
+                    const DTWAIN_ARRAY acquisitions = m_acquireResult.second.get_array();
+                    if (!image || !acquisitions)
+                        return;
+                    const LONG num_acquisitions = API_INSTANCE DTWAIN_ArrayGetCount(acquisitions);
+                    for (LONG i = 0; i < num_acquisitions; ++i)
+                    {
+                        DTWAIN_ARRAY pages = nullptr;
+                        if (!API_INSTANCE DTWAIN_ArrayGetAt(acquisitions, i, &pages) || !pages)
+                            continue;
+                        const LONG num_pages = API_INSTANCE DTWAIN_ArrayGetCount(pages);
+                        for (LONG j = 0; j < num_pages; ++j)
+                        {
+                            HANDLE page = nullptr;
+                            if (API_INSTANCE DTWAIN_ArrayGetAt(pages, j, &page) && page == image)
+                            {
+                                API_INSTANCE DTWAIN_ArrayRemoveAt(pages, j);
+                                return;
+                            }
+                        }
+                    }
+                }
+
+                void free_page(acquired_page& page)
+                {
+                    m_pSource->get_memory_budget().release(page.image);
+                    remove_from_acquisition(page.image);
+                    #ifdef _WIN32
+                    if (page.image)
+                    {
+                        // the stores must not restore a page over a handle that has been freed and reused
+                        page_spill_store::forget(page.image);
+                        page_compression_store::forget(page.image);
+                        ::GlobalFree(page.image);
+                    }
+                    #endif
+                    page.image = nullptr;
+                }
+
+            public:
+                /// Creates a page stream for **source**.  The acquisition uses the source's acquire_characteristics, and
+                /// starts on the first call to next() or begin().
+                /// @param[in] source The open twain_source to acquire from
+                /// @param[in] wait_interval The longest time to block between checks for TWAIN messages
+                explicit twain_page_stream(twain_source& source, std::chrono::milliseconds wait_interval = std::chrono::milliseconds(10)) :
+                    m_pSource(&source), m_looper(source), m_waitInterval(wait_interval) {}
+
+                twain_page_stream(const twain_page_stream&) = delete;
+                twain_page_stream& operator=(const twain_page_stream&) = delete;
+
+                /// Cancels the acquisition if it is still running, and frees the pages that were not returned
+                ~twain_page_stream()
+                {
+                    if (m_bStarted && !m_bFinished)
+                        cancel();
+                    for (auto& page : m_pages)
+                        free_page(page);
+                }
+
+                /// Waits for the next page.
+                /// @param[out] page The page that was acquired
+                /// @returns **true** if a page was returned, **false** if the acquisition has ended
+                bool next(acquired_page& page)
+                {
+                    while (true)
+                    {
+                        fill();
+                        if (m_pages.empty())
+                            return false;
+                        page = m_pages.front();
+                        m_pages.pop_front();
+                        if (!page.image)
+                            return true;
+                        // the caller owns the page from now on, so it is restored and no longer spilled.  A page that
+                        // cannot be restored is freed, and the next page is returned.
+                        if (page_spill_store::ensure_resident(page.image))
+                        {
+                            page_spill_store::forget(page.image);
+                            page_compression_store::forget(page.image);
+                            remove_from_acquisition(page.image);
+                            return true;
+                        }
+                        free_page(page);
+                    }
+                }
+
+                /// Stops the device from transferring more pages, and waits for the acquisition to end.
+                ///
+                /// Pages that were already transferred, but not yet returned by next(), are freed.
+                void cancel()
+                {
+                    m_bCancelled = true;
+                    if (!m_bStarted)
+                    {
+                        m_bStarted = m_bFinished = true;
+                        return;
+                    }
+                    while (!m_bFinished)
+                    {
+                        for (auto& page : m_pages)
+                            free_page(page);
+                        m_pages.clear();
+                        fill();
+                    }
+                    for (auto& page : m_pages)
+                        free_page(page);
+                    m_pages.clear();
+                }
+
+                iterator begin() { return iterator(this); }
+                iterator end() noexcept { return iterator(); }
+
+                #if defined(__cpp_lib_generator)
+                /// Returns the pages as a std::generator, for use in coroutines
+                std::generator<const acquired_page&> pages()
+                {
+                    for (const auto& page : *this)
+                        co_yield page;
+                }
+                #endif
+
+                /// Returns the status returned when the acquisition was started (twain_source::acquire_ok if successful)
+                int32_t get_acquire_status() const noexcept { return m_nAcquireStatus; }
+
+                /// Returns the number of pages transferred so far
+                size_t get_page_count() const noexcept { return m_nPageCount; }
+
+                bool is_cancelled() const noexcept { return m_bCancelled; }
+                bool is_finished() const noexcept { return m_bFinished; }
+        };
+    }
+}
+#endif
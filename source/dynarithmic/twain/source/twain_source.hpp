@@ -26,13 +26,17 @@ OF THIRD PARTY RIGHTS.
 #include <functional>
 #include <algorithm>
 #include <chrono>
+#include <mutex>
 #include <thread>
 #include <tuple>
 #include <numeric>
 
 #include <dynarithmic/twain/acquire_characteristics.hpp>
 #include <dynarithmic/twain/capability_interface.hpp>
+#include <dynarithmic/twain/capability_interface/capability_state.hpp>
+#include <dynarithmic/twain/imagehandler/blank_page_detector.hpp>
 #include <dynarithmic/twain/imagehandler/image_handler.hpp>
+#include <dynarithmic/twain/imagehandler/thumbnail_generator.hpp>
 #include <dynarithmic/twain/info/buffered_transfer_info.hpp>
 #include <dynarithmic/twain/info/file_transfer_info.hpp>
 #include <dynarithmic/twain/info/info_base.hpp>
@@ -42,13 +46,18 @@ OF THIRD PARTY RIGHTS.
 #include <dynarithmic/twain/options/ui_options.hpp>
 #include <dynarithmic/twain/session/twain_session.hpp>
 #include <dynarithmic/twain/source/twain_source_base.hpp>
+#include <dynarithmic/twain/source/applied_settings_cache.hpp>
+#include <dynarithmic/twain/source/memory_budget.hpp>
 #include <dynarithmic/twain/twain_values.hpp>
+#include <dynarithmic/twain/types/twain_global_memory.hpp>
 #include <dynarithmic/twain/types/twain_listener.hpp>
 #include <dynarithmic/twain/types/twain_timer.hpp>
 
 namespace dynarithmic {
 namespace twain {
     class twain_session;
+    class device_profile_manager;
+    class acquisition_profile;
 
     /**
         The twain_source class is the main class that represents a TWAIN device (the DTWAIN_SOURCE when referring to the underlying DTWAIN API).  The device has to be selected first 
@@ -117,10 +126,130 @@ namespace twain {
         bool m_bCloseable = true;
         acquire_characteristics m_acquire_characteristics;
         buffered_transfer_info m_buffered_info;
-        file_transfer_info m_filetransfer_info;
+
+        // Device information that is retrieved once per open, and only retrieved again when one of the capabilities it
+        // depends on is set to a different value.
+        template <typename Info>
+        struct memoized_info
+        {
+            Info info;
+            bool is_valid = false;
+            uint64_t generation = 0;
+        };
+        memoized_info<file_transfer_info> m_filetransfer_info;
+        memoized_info<paperhandling_info> m_paperhandling_info;
+
+        // the non-capability settings last applied to the device, so that unchanged settings are not applied again
+        applied_settings_cache m_applied_settings;
+
+        // capability state published for other threads after each negotiation, if any capabilities are monitored
+        std::shared_ptr<capability_state_publisher> m_state_publisher = std::make_shared<capability_state_publisher>();
+        std::vector<capability_query> m_monitored_caps;
+
+        // memory held by pages acquired to memory.  Shared, so that consumers on other threads can release pages.
+        std::shared_ptr<memory_budget> m_memory_budget = std::make_shared<memory_budget>();
+
+        // where pages acquired to memory are spilled once too many are resident, if a spill policy is set
+        std::shared_ptr<page_spill_store> m_spill_store;
+
+        // compresses pages acquired to memory in the background, if compression is turned on
+        std::shared_ptr<page_compression_store> m_compression_store;
+
+        // where each page acquired to memory is also written, if a page store is set
+        std::shared_ptr<mapped_page_store> m_page_store;
+
+        // scores of the pages examined by the vectorized blank page detector during the last acquisition
+        struct blank_page_log
+        {
+            std::mutex mutex;
+            std::vector<blank_page_score> scores;
+        };
+        std::shared_ptr<blank_page_log> m_blank_page_log = std::make_shared<blank_page_log>();
+
+        // thumbnails of the pages of the last acquisition, if thumbnails are turned on
+        struct thumbnail_log
+        {
+            std::mutex mutex;
+            std::vector<thumbnail> thumbnails;
+            std::function<void(const thumbnail&)> callback;
+        };
+        std::shared_ptr<thumbnail_log> m_thumbnail_log = std::make_shared<thumbnail_log>();
+        int32_t m_thumbnail_max_width = 0;
+        int32_t m_thumbnail_max_height = 0;
+
+        // classification of the pages of the last acquisition, if color detection is turned on
+        struct color_detection_log
+        {
+            std::mutex mutex;
+            std::vector<page_color_info> pages;
+        };
+        std::shared_ptr<color_detection_log> m_color_detection_log = std::make_shared<color_detection_log>();
+
+        // results of duplicate page detection during the last acquisition
+        struct duplicate_page_log
+        {
+            std::mutex mutex;
+            std::vector<duplicate_page_result> results;
+        };
+        std::shared_ptr<duplicate_page_log> m_duplicate_page_log = std::make_shared<duplicate_page_log>();
+
+        // results of software deskew during the last acquisition
+        struct deskew_log
+        {
+            std::mutex mutex;
+            std::vector<deskew_result> results;
+        };
+        std::shared_ptr<deskew_log> m_deskew_log = std::make_shared<deskew_log>();
 
         std::unique_ptr<capability_listener> m_capability_listener;
 
+        // Set when a device profile has already placed the device in the state described by the acquire_characteristics,
+        // so that the next acquisition does not need to set each capability individually.
+        bool m_bCapsPreApplied = false;
+
+        // Set while a twain_page_stream drives the acquisition
+        bool m_bStreamed = false;
+        uint64_t m_nPreAppliedFingerprint = 0;
+        uint64_t m_nPreAppliedGeneration = 0;
+
+        // while non-zero, capability sets only mark the monitored state as out of date, and it is published once when
+        // the outermost publish_deferral ends
+        int m_nPublishDeferrals = 0;
+        bool m_bPublishPending = false;
+
+        friend class device_profile_manager;
+        friend class acquisition_profile;
+        friend class twain_page_stream;
+        friend class twain_actor;
+
+        // publishes the monitored capability state once for a group of capability sets, instead of after each set
+        class publish_deferral
+        {
+            twain_source* m_pSource;
+            public:
+                explicit publish_deferral(twain_source* pSource) : m_pSource(pSource) { ++m_pSource->m_nPublishDeferrals; }
+                publish_deferral(const publish_deferral&) = delete;
+                publish_deferral& operator=(const publish_deferral&) = delete;
+                ~publish_deferral()
+                {
+                    if (--m_pSource->m_nPublishDeferrals == 0 && m_pSource->m_bPublishPending)
+                        m_pSource->publish_capability_state();
+                }
+        };
+
+        void on_capability_set()
+        {
+            if (m_nPublishDeferrals > 0)
+                m_bPublishPending = true;
+            else
+                publish_capability_state();
+        }
+
+        void install_set_listener()
+        {
+            m_capability_info.set_set_listener([this](int) { on_capability_set(); });
+        }
+
         void get_source_info_internal()
         {
             const auto p_id = static_cast<TW_IDENTITY*>(API_INSTANCE DTWAIN_GetSourceID(m_theSource));
@@ -137,13 +266,22 @@ namespace twain {
             if (val2 != static_cast<decltype(val2)>(acquire_characteristics::default_##x)) {\
                 m_capability_info.set_##y({val2}); } }
 
+        void invalidate_info() noexcept
+        {
+            m_filetransfer_info.is_valid = false;
+            m_paperhandling_info.is_valid = false;
+            m_applied_settings.clear();
+        }
+
         void attach(DTWAIN_SOURCE source)
         {
             m_theSource = source;
+            invalidate_info();
             if (source)
             {
                 get_source_info_internal();
                 m_capability_info.attach(source);
+                install_set_listener();
                 m_buffered_info.attach(*this);
                 m_bIsSelected = true;
             }
@@ -153,6 +291,7 @@ namespace twain {
 
         void start_apply()
         {
+            publish_deferral deferral(this);
             auto& ci = get_capability_interface();
             auto& ac = get_acquire_characteristics();
             options_base::apply(*this, ac.get_language_options());
@@ -179,37 +318,79 @@ namespace twain {
             options_base::apply(*this, ac.get_imprinter_options());
         }
 
+        void mark_caps_applied()
+        {
+            mark_caps_applied(get_characteristics_fingerprint());
+        }
+
+        void mark_caps_applied(uint64_t fingerprint)
+        {
+            m_nPreAppliedFingerprint = fingerprint;
+            m_nPreAppliedGeneration = m_capability_info.get_set_generation();
+            m_bCapsPreApplied = true;
+        }
+
+        // the device state was replaced as a whole, so nothing that was retrieved or applied before is still known
+        void invalidate_device_state()
+        {
+            invalidate_info();
+            m_capability_info.invalidate_device_state();
+            on_capability_set();
+        }
+
+        bool is_caps_preapplied()
+        {
+            return m_bCapsPreApplied &&
+                   m_nPreAppliedGeneration == m_capability_info.get_set_generation() &&
+                   m_nPreAppliedFingerprint == get_characteristics_fingerprint();
+        }
+
         void prepare_acquisition()
         {
             acquire_characteristics& ac = m_acquire_characteristics;
-            start_apply();
+            publish_deferral deferral(this);
+
+            // skip the individual capability sets if a device profile has already set up the device
+            if (!is_caps_preapplied())
+                start_apply();
+            m_bCapsPreApplied = false;
+
+            auto& applied = m_applied_settings;
 
             // set the acquisition area
             auto twframe = ac.get_pages_options().get_frame();
 
             // if user has overridden the default...
-            if (twframe != twain_frame<>())
+            const bool use_area = (twframe != twain_frame<>());
+            if (applied.needs_apply(applied_setting::acquire_area, use_area, twframe))
             {
-                DTWAIN_ARRAY area = API_INSTANCE DTWAIN_ArrayCreate(DTWAIN_ARRAYFLOAT, 4);
-                twain_array arr(area);
-                double* buffer = arr.get_buffer<double>();
-                buffer[0] = twframe.left;
-                buffer[1] = twframe.top;
-                buffer[2] = twframe.right;
-                buffer[3] = twframe.bottom;
-                API_INSTANCE DTWAIN_SetAcquireArea(m_theSource, DTWAIN_AREASET, area, NULL);
+                if (use_area)
+                {
+                    DTWAIN_ARRAY area = API_INSTANCE DTWAIN_ArrayCreate(DTWAIN_ARRAYFLOAT, 4);
+                    twain_array arr(area);
+                    double* buffer = arr.get_buffer<double>();
+                    buffer[0] = twframe.left;
+                    buffer[1] = twframe.top;
+                    buffer[2] = twframe.right;
+                    buffer[3] = twframe.bottom;
+                    API_INSTANCE DTWAIN_SetAcquireArea(m_theSource, DTWAIN_AREASET, area, NULL);
+                }
+                else
+                    API_INSTANCE DTWAIN_SetAcquireArea(m_theSource, DTWAIN_AREARESET, NULL, NULL);
             }
-            else
-                API_INSTANCE DTWAIN_SetAcquireArea(m_theSource, DTWAIN_AREARESET, NULL, NULL);
 
             // Set the job control option
-            API_INSTANCE DTWAIN_SetJobControl(m_theSource, static_cast<LONG>(ac.get_jobcontrol_options().get_option()), TRUE);
-
-            // Disable the manual duplex mode
-            API_INSTANCE DTWAIN_SetManualDuplexMode(m_theSource, 0, FALSE);
+            const auto job_control = static_cast<LONG>(ac.get_jobcontrol_options().get_option());
+            if (applied.needs_apply(applied_setting::job_control, job_control))
+                API_INSTANCE DTWAIN_SetJobControl(m_theSource, job_control, TRUE);
 
             // Get the duplex mode
             auto dupmode = ac.get_paperhandling_options().get_manualduplexmode();
+            const bool dupmode_changed = applied.needs_apply(applied_setting::manual_duplex, static_cast<LONG>(dupmode));
+
+            // Disable the manual duplex mode
+            if (dupmode_changed)
+                API_INSTANCE DTWAIN_SetManualDuplexMode(m_theSource, 0, FALSE);
 
             switch (dupmode)
             {
@@ -221,46 +402,67 @@ namespace twain {
                 // manual duplex mode chosen, so turn this on
                 default:
 
-                    // turn off device's duplex mode, if available
+                    // turn off device's duplex mode, if available.  This is always done, since the capabilities may have
+                    // turned it back on.
                     get_capability_interface().set_cap_values< CAP_DUPLEXENABLED_>({ false });
 
                     // turn on manual duplex mode
-                    API_INSTANCE DTWAIN_SetManualDuplexMode(m_theSource, static_cast<LONG>(dupmode), TRUE);
+                    if (dupmode_changed)
+                        API_INSTANCE DTWAIN_SetManualDuplexMode(m_theSource, static_cast<LONG>(dupmode), TRUE);
                 break;
             }
 
-            API_INSTANCE DTWAIN_SetAcquireImageNegative(m_theSource, ac.get_imagetype_options().get_negate() ? TRUE : FALSE);
+            const bool negate = ac.get_imagetype_options().get_negate();
+            if (applied.needs_apply(applied_setting::image_negative, negate))
+                API_INSTANCE DTWAIN_SetAcquireImageNegative(m_theSource, negate ? TRUE : FALSE);
             auto& blank_handler = ac.get_blank_page_options();
-            API_INSTANCE DTWAIN_SetBlankPageDetection(m_theSource, blank_handler.get_threshold(),
-                static_cast<LONG>(blank_handler.get_discard_option()),
-                static_cast<LONG>(blank_handler.is_enabled()));
+            const auto blank_discard = static_cast<LONG>(blank_handler.get_discard_option());
+            // the vectorized detector replaces DTWAIN's detection
+            const auto blank_enabled = static_cast<LONG>(blank_handler.is_enabled() &&
+                                                         blank_handler.get_detection_method() == blankpage_detection_method::dtwain);
+            if (applied.needs_apply(applied_setting::blank_page_detection, blank_handler.get_threshold(), blank_discard, blank_enabled))
+                API_INSTANCE DTWAIN_SetBlankPageDetection(m_theSource, blank_handler.get_threshold(), blank_discard, blank_enabled);
             auto& multisave_info = ac.get_file_transfer_options().get_multipage_save_options();
-            API_INSTANCE DTWAIN_SetMultipageScanMode(m_theSource,
-                static_cast<LONG>(multisave_info.get_save_mode())
+            const LONG scan_mode = static_cast<LONG>(multisave_info.get_save_mode())
                 |
-                (multisave_info.is_save_incomplete() ? static_cast<LONG>(multipage_save_mode::save_incomplete) : 0));
+                (multisave_info.is_save_incomplete() ? static_cast<LONG>(multipage_save_mode::save_incomplete) : 0);
+            if (applied.needs_apply(applied_setting::multipage_scan_mode, scan_mode))
+                API_INSTANCE DTWAIN_SetMultipageScanMode(m_theSource, scan_mode);
 
             // Get the general options
             general_options& gOpts = ac.get_general_options();
-            API_INSTANCE DTWAIN_SetMaxAcquisitions(m_theSource, gOpts.get_max_acquisitions());
+            if (applied.needs_apply(applied_setting::max_acquisitions, gOpts.get_max_acquisitions()))
+                API_INSTANCE DTWAIN_SetMaxAcquisitions(m_theSource, gOpts.get_max_acquisitions());
 
             set_pdf_options();
+
+            // the capabilities have been negotiated, so let the monitoring threads see the new state
+            m_bPublishPending = true;
         }
 
         void set_pdf_options()
         {
             auto source = get_source();
 
-            // set the PDF file properties
+            // set the PDF file properties.  Properties that have not changed since the last acquisition are not set again.
+            auto& applied = m_applied_settings;
             pdf_options& po = m_acquire_characteristics.get_pdf_options();
-            API_INSTANCE DTWAIN_SetPDFCreatorA(source, po.get_creator().c_str());
-            API_INSTANCE DTWAIN_SetPDFTitleA(source, po.get_title().c_str());
-            API_INSTANCE DTWAIN_SetPDFProducerA(source, po.get_creator().c_str());
-            API_INSTANCE DTWAIN_SetPDFAuthorA(source, po.get_author().c_str());
-            API_INSTANCE DTWAIN_SetPDFSubjectA(source, po.get_subject().c_str());
-            API_INSTANCE DTWAIN_SetPDFKeywordsA(source, po.get_keywords().c_str());
-            API_INSTANCE DTWAIN_SetPDFASCIICompression(source, po.is_use_ASCII());
-            API_INSTANCE DTWAIN_SetPDFOrientation(source, static_cast<LONG>(po.get_orientation()));
+            if (applied.needs_apply(applied_setting::pdf_creator, po.get_creator()))
+                API_INSTANCE DTWAIN_SetPDFCreatorA(source, po.get_creator().c_str());
+            if (applied.needs_apply(applied_setting::pdf_title, po.get_title()))
+                API_INSTANCE DTWAIN_SetPDFTitleA(source, po.get_title().c_str());
+            if (applied.needs_apply(applied_setting::pdf_producer, po.get_creator()))
+                API_INSTANCE DTWAIN_SetPDFProducerA(source, po.get_creator().c_str());
+            if (applied.needs_apply(applied_setting::pdf_author, po.get_author()))
+                API_INSTANCE DTWAIN_SetPDFAuthorA(source, po.get_author().c_str());
+            if (applied.needs_apply(applied_setting::pdf_subject, po.get_subject()))
+                API_INSTANCE DTWAIN_SetPDFSubjectA(source, po.get_subject().c_str());
+            if (applied.needs_apply(applied_setting::pdf_keywords, po.get_keywords()))
+                API_INSTANCE DTWAIN_SetPDFKeywordsA(source, po.get_keywords().c_str());
+            if (applied.needs_apply(applied_setting::pdf_ascii_compression, po.is_use_ASCII()))
+                API_INSTANCE DTWAIN_SetPDFASCIICompression(source, po.is_use_ASCII());
+            if (applied.needs_apply(applied_setting::pdf_orientation, static_cast<LONG>(po.get_orientation())))
+                API_INSTANCE DTWAIN_SetPDFOrientation(source, static_cast<LONG>(po.get_orientation()));
 
             // Set PDF page size
             auto& pagesizeopts = po.get_page_size_options();
@@ -273,7 +475,9 @@ namespace twain {
                 width = pr.first;
                 height = pr.second;
             }
-            API_INSTANCE DTWAIN_SetPDFPageSize(source, static_cast<LONG>(po.get_page_size_options().get_page_size()), width, height);
+            const auto page_size = static_cast<LONG>(po.get_page_size_options().get_page_size());
+            if (applied.needs_apply(applied_setting::pdf_page_size, page_size, width, height))
+                API_INSTANCE DTWAIN_SetPDFPageSize(source, page_size, width, height);
 
             // Set PDF page scale
             auto& pagescaleopts = po.get_page_scale_options();
@@ -286,11 +490,15 @@ namespace twain {
                 xscale = pr.first;
                 yscale = pr.second;
             }
-            API_INSTANCE DTWAIN_SetPDFPageScale(source, static_cast<LONG>(po.get_page_scale_options().get_page_scale()), xscale, yscale);
+            const auto page_scale = static_cast<LONG>(po.get_page_scale_options().get_page_scale());
+            if (applied.needs_apply(applied_setting::pdf_page_scale, page_scale, xscale, yscale))
+                API_INSTANCE DTWAIN_SetPDFPageScale(source, page_scale, xscale, yscale);
 
             // Set encryption options
             auto& encrypt_opts = po.get_encryption_options();
-            if (encrypt_opts.is_use_encryption())
+            if (encrypt_opts.is_use_encryption() &&
+                applied.needs_apply(applied_setting::pdf_encryption, encrypt_opts.get_user_password(), encrypt_opts.get_owner_password(),
+                                    encrypt_opts.get_permissions_int(), encrypt_opts.is_use_strong_encryption()))
             {
                 API_INSTANCE DTWAIN_SetPDFEncryptionA(source, 1, encrypt_opts.get_user_password().c_str(),
                     encrypt_opts.get_owner_password().c_str(),
@@ -309,6 +517,32 @@ namespace twain {
             std::swap(left.m_capability_info, right.m_capability_info);
             std::swap(left.m_pSession, right.m_pSession);
             std::swap(left.m_bUIOnlyOn, right.m_bUIOnlyOn);
+            std::swap(left.m_bCapsPreApplied, right.m_bCapsPreApplied);
+            std::swap(left.m_nPreAppliedFingerprint, right.m_nPreAppliedFingerprint);
+            std::swap(left.m_nPreAppliedGeneration, right.m_nPreAppliedGeneration);
+            std::swap(left.m_bStreamed, right.m_bStreamed);
+            std::swap(left.m_filetransfer_info, right.m_filetransfer_info);
+            std::swap(left.m_paperhandling_info, right.m_paperhandling_info);
+            std::swap(left.m_applied_settings, right.m_applied_settings);
+            std::swap(left.m_state_publisher, right.m_state_publisher);
+            std::swap(left.m_monitored_caps, right.m_monitored_caps);
+            std::swap(left.m_memory_budget, right.m_memory_budget);
+            std::swap(left.m_spill_store, right.m_spill_store);
+            std::swap(left.m_compression_store, right.m_compression_store);
+            std::swap(left.m_page_store, right.m_page_store);
+            std::swap(left.m_blank_page_log, right.m_blank_page_log);
+            std::swap(left.m_thumbnail_log, right.m_thumbnail_log);
+            std::swap(left.m_thumbnail_max_width, right.m_thumbnail_max_width);
+            std::swap(left.m_thumbnail_max_height, right.m_thumbnail_max_height);
+            std::swap(left.m_color_detection_log, right.m_color_detection_log);
+            std::swap(left.m_duplicate_page_log, right.m_duplicate_page_log);
+            std::swap(left.m_deskew_log, right.m_deskew_log);
+
+            // the set listeners publish the state of the twain_source that owns the capability_interface
+            if (left.m_theSource)
+                left.install_set_listener();
+            if (right.m_theSource)
+                right.install_set_listener();
         }
 
         acquire_return_type acquire_to_file(transfer_type transtype)
@@ -330,7 +564,7 @@ namespace twain {
             }
             // check for auto increment
             filename_increment_rules& inc = ftOptions.get_filename_increment_rules();
-            file_transfer_info& fTransfer = info_base::get_file_transfer_info(*this);
+            const file_transfer_info& fTransfer = get_file_transfer_info();
             API_INSTANCE DTWAIN_SetFileAutoIncrement(m_theSource, inc.get_increment(), inc.is_reset_count_used() ? TRUE : FALSE,
                                         inc.is_enabled() ? TRUE : FALSE);
             API_INSTANCE DTWAIN_EnableMsgNotify(1);
@@ -354,11 +588,418 @@ namespace twain {
 
             // if app is modeless, this needs to go back to the caller to loop
             if (retval)
-                return { acquire_ok, {} };
+                return { acquire_ok, twain_array() };
             else
-                return { acquire_canceled, {} };
+                return { acquire_canceled, twain_array() };
+        }
+
+        // DTWAIN sends the notifications of every source of the session to the same callback, with the source that
+        // sent the notification in **lParam**
+        static bool is_from_source(LPARAM lParam, DTWAIN_SOURCE source) noexcept
+        {
+            return reinterpret_cast<DTWAIN_SOURCE>(lParam) == source;
+        }
+
+        // Charges each page and transfer strip to the memory budget, and holds back the next page while the
+        // budget is exhausted.  The hook is keyed by the budget, so it survives the twain_source being moved.
+        void install_memory_budget_hook(size_t strip_size)
+        {
+            if (!m_pSession)
+                return;
+            auto& hooks = m_pSession->get_notification_hooks();
+            if (!m_memory_budget->is_enabled())
+            {
+                hooks.erase(m_memory_budget.get());
+                return;
+            }
+            std::shared_ptr<memory_budget> budget = m_memory_budget;
+            DTWAIN_SOURCE source = m_theSource;
+            // a twain_page_stream waits for the budget itself, between pumps of the TWAIN loop
+            const bool hold = !m_bStreamed;
+            hooks[budget.get()] = [budget, source, strip_size, hold](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                switch (static_cast<LONG>(wParam))
+                {
+                    case DTWAIN_TN_TRANSFERREADY:
+                        return !hold || budget->wait_for_capacity() ? 1 : 0;
+
+                    case DTWAIN_TN_TRANSFERSTRIPREADY:
+                        budget->charge(budget.get(), strip_size);
+                    break;
+
+                    case DTWAIN_TN_TRANSFERDONE:
+                        budget->charge_image(API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source));
+                    break;
+
+                    case DTWAIN_TN_ACQUIREDONE:
+                    case DTWAIN_TN_ACQUIREFAILED:
+                    case DTWAIN_TN_ACQUIRECANCELLED:
+                    case DTWAIN_TN_ACQUIRETERMINATED:
+                        budget->release(budget.get());
+                    break;
+                }
+                return 1;
+            };
+        }
+
+        void remove_memory_budget_hook()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_hooks().erase(m_memory_budget.get());
+        }
+
+        // Writes each page to the page store as it is transferred.  Pages are numbered by acquisition, starting
+        // after the last acquisition already in the store.
+        void install_page_store_hook()
+        {
+            if (!m_pSession || !m_page_store)
+                return;
+            std::shared_ptr<mapped_page_store> store = m_page_store;
+            DTWAIN_SOURCE source = m_theSource;
+            const auto index = store->get_index();
+            auto counters = std::make_shared<std::pair<uint32_t, uint32_t>>(index.empty() ? 0 : index.back().acquisition + 1, 0);
+            m_pSession->get_notification_hooks()[store.get()] = [store, source, counters](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                switch (static_cast<LONG>(wParam))
+                {
+                    case DTWAIN_TN_TRANSFERDONE:
+                        store->add_page(API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source), counters->first, counters->second++);
+                    break;
+                    case DTWAIN_TN_ACQUIREDONE:
+                        ++counters->first;
+                        counters->second = 0;
+                    break;
+                }
+                return 1;
+            };
+        }
+
+        void remove_page_store_hook()
+        {
+            if (m_pSession && m_page_store)
+                m_pSession->get_notification_hooks().erase(m_page_store.get());
+        }
+
+        // Scores each page with the vectorized blank page detector as it arrives, before it is encoded or added to the
+        // other stores, and asks DTWAIN to discard blank pages.  Pages are scored after they are deskewed and reduced.
+        void install_blank_page_filter()
+        {
+            remove_blank_page_filter();
+            const auto& bp = m_acquire_characteristics.get_blank_page_options();
+            if (!m_pSession || !bp.is_enabled() || bp.get_detection_method() != blankpage_detection_method::vectorized)
+                return;
+            blank_page_detector detector(bp.get_threshold());
+            detector.set_margin(bp.get_margin()).set_noise_tolerance(bp.get_noise_tolerance()).set_ink_level(bp.get_ink_level());
+            const bool discard = bp.get_discard_option() != blankpage_discard_option::discard_all_on_notification;
+
+            std::shared_ptr<blank_page_log> log = m_blank_page_log;
+            {
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->scores.clear();
+            }
+            std::shared_ptr<memory_budget> budget = m_memory_budget;
+            DTWAIN_SOURCE source = m_theSource;
+            // the page last scored, and whether it is blank
+            auto current = std::make_shared<std::pair<HANDLE, bool>>(nullptr, false);
+            m_pSession->get_notification_filters().install(log.get(), notification_stage::analyze,
+                                                           [=](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                const LONG notification = static_cast<LONG>(wParam);
+                if (notification == DTWAIN_TN_TRANSFERREADY)
+                    *current = { nullptr, false };
+                if (notification != DTWAIN_TN_TRANSFERDONE && notification != DTWAIN_TN_QUERYPAGEDISCARD)
+                    return 1;
+                HANDLE h = API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source);
+                if (!h)
+                    return 1;
+                if (current->first != h)
+                {
+                    blank_page_score score;
+                    if (const void* p = twain_global_memory::lock(h))
+                    {
+                        score = detector.analyze(image_view::from_dib(p, twain_global_memory::size(h)));
+                        twain_global_memory::unlock(h);
+                    }
+                    *current = { h, score.is_blank };
+                    std::lock_guard<std::mutex> lock(log->mutex);
+                    log->scores.push_back(score);
+                }
+                if (notification == DTWAIN_TN_QUERYPAGEDISCARD && current->second && discard)
+                {
+                    // DTWAIN frees the page, so nothing may refer to it
+                    budget->release(h);
+                    page_spill_store::forget(h);
+                    page_compression_store::forget(h);
+                    *current = { nullptr, false };
+                    return 0;
+                }
+                return 1;
+            });
+        }
+
+        void remove_blank_page_filter()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_filters().erase(m_blank_page_log.get());
         }
 
+        // Makes a thumbnail of each page as it arrives, before it is encoded or added to the other stores
+        void install_thumbnail_filter()
+        {
+            remove_thumbnail_filter();
+            if (!m_pSession || m_thumbnail_max_width <= 0 || m_thumbnail_max_height <= 0)
+                return;
+            std::shared_ptr<thumbnail_log> log = m_thumbnail_log;
+            {
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->thumbnails.clear();
+            }
+            auto generator = std::make_shared<thumbnail_generator>();
+            generator->set_max_size(m_thumbnail_max_width, m_thumbnail_max_height);
+            DTWAIN_SOURCE source = m_theSource;
+            m_pSession->get_notification_filters().install(log.get(), notification_stage::analyze,
+                                                           [log, generator, source](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                if (static_cast<LONG>(wParam) != DTWAIN_TN_TRANSFERDONE)
+                    return 1;
+                HANDLE h = API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source);
+                const void* p = twain_global_memory::lock(h);
+                if (!p)
+                    return 1;
+                thumbnail thumb = generator->generate(image_view::from_dib(p, twain_global_memory::size(h)));
+                twain_global_memory::unlock(h);
+                std::function<void(const thumbnail&)> callback;
+                {
+                    std::lock_guard<std::mutex> lock(log->mutex);
+                    thumb.page_number = log->thumbnails.size();
+                    log->thumbnails.push_back(thumb);
+                    callback = log->callback;
+                }
+                if (callback)
+                    callback(thumb);
+                return 1;
+            });
+        }
+
+        void remove_thumbnail_filter()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_filters().erase(m_thumbnail_log.get());
+        }
+
+        // Classifies each page as it arrives and, in colordetection_mode::reduce, rewrites a color page that has no color
+        // as a gray or bitonal DIB in the same handle, so the smaller page is the one DTWAIN keeps.  Pages are only
+        // reduced for image transfers: in a file transfer DTWAIN encodes the page with the pixel type it negotiated.
+        void install_color_detection_filter()
+        {
+            remove_color_detection_filter();
+            const auto& cd = m_acquire_characteristics.get_color_detection_options();
+            if (!m_pSession || !cd.is_enabled())
+                return;
+            color_detector detector;
+            detector.set_chroma_tolerance(cd.get_chroma_tolerance()).set_color_threshold(cd.get_color_threshold()).
+                     set_midtone_threshold(cd.get_midtone_threshold());
+            const colordetection_options options = cd;
+            const auto transtype = m_acquire_characteristics.get_general_options().get_transfer_type();
+            const bool reduce = options.get_mode() == colordetection_mode::reduce &&
+                                (transtype == transfer_type::image_native || transtype == transfer_type::image_buffered);
+            std::shared_ptr<color_detection_log> log = m_color_detection_log;
+            {
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->pages.clear();
+            }
+            DTWAIN_SOURCE source = m_theSource;
+            m_pSession->get_notification_filters().install(log.get(), notification_stage::reduce,
+                                                           [=](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                if (static_cast<LONG>(wParam) != DTWAIN_TN_TRANSFERDONE)
+                    return 1;
+                HANDLE h = API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source);
+                const void* p = twain_global_memory::lock(h);
+                if (!p)
+                    return 1;
+                page_color_info info;
+                const image_view view = image_view::from_dib(p, twain_global_memory::size(h));
+                info.analysis = detector.analyze(view);
+                info.bits_per_pixel = info.stored_bits_per_pixel = view.bits_per_pixel();
+                info.suggested_file_type = options.get_file_type(info.analysis.classification);
+
+                std::vector<unsigned char> reduced;
+                const uint16_t reduced_bits = info.analysis.classification == color_class::bitonal ? 1 : 8;
+                if (reduce && info.analysis.classification != color_class::color && reduced_bits < info.bits_per_pixel)
+                    reduced = color_detector::convert(view, info.analysis.classification, options.get_bitonal_threshold());
+                twain_global_memory::unlock(h);
+
+                // The reduced page is written over the original, so DTWAIN and the other stores still refer to it, and the
+                // block is then shrunk.  Only a moveable block keeps its handle when it is resized, so a fixed block is
+                // left as it was acquired.  If a moveable block cannot be shrunk, it keeps its size and still holds a
+                // valid (converted) page, but the page does not count as reduced.
+                if (!reduced.empty() && reduced.size() <= twain_global_memory::size(h))
+                {
+                    if (void* dest = twain_global_memory::lock(h))
+                    {
+                        const bool moveable = twain_global_memory::is_moveable(h, dest);
+                        if (moveable)
+                            std::copy(reduced.begin(), reduced.end(), static_cast<unsigned char*>(dest));
+                        twain_global_memory::unlock(h);
+                        if (moveable)
+                        {
+                            info.stored_bits_per_pixel = reduced_bits;
+                            info.reduced = twain_global_memory::resize(h, reduced.size());
+                        }
+                    }
+                }
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->pages.push_back(info);
+                return 1;
+            });
+        }
+
+        void remove_color_detection_filter()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_filters().erase(m_color_detection_log.get());
+        }
+
+        // Hashes each page as it arrives and compares it with the recent pages of the acquisition
+        void install_duplicate_page_filter()
+        {
+            remove_duplicate_page_filter();
+            const auto& dp = m_acquire_characteristics.get_duplicate_page_options();
+            if (!m_pSession || !dp.is_enabled())
+                return;
+            auto detector = std::make_shared<duplicate_page_detector>();
+            detector->set_window(dp.get_window()).set_max_distance(dp.get_max_distance());
+            const bool discard = dp.get_action() == duplicatepage_action::discard;
+
+            std::shared_ptr<duplicate_page_log> log = m_duplicate_page_log;
+            {
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->results.clear();
+            }
+            std::shared_ptr<memory_budget> budget = m_memory_budget;
+            DTWAIN_SOURCE source = m_theSource;
+            // the page last hashed, and whether it is a duplicate
+            auto current = std::make_shared<std::pair<HANDLE, bool>>(nullptr, false);
+            m_pSession->get_notification_filters().install(log.get(), notification_stage::analyze,
+                                                           [=](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                const LONG notification = static_cast<LONG>(wParam);
+                if (notification == DTWAIN_TN_TRANSFERREADY)
+                    *current = { nullptr, false };
+                if (notification != DTWAIN_TN_TRANSFERDONE && notification != DTWAIN_TN_QUERYPAGEDISCARD)
+                    return 1;
+                HANDLE h = API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source);
+                if (!h)
+                    return 1;
+                if (current->first != h)
+                {
+                    const void* p = twain_global_memory::lock(h);
+                    if (!p)
+                        return 1;
+                    const duplicate_page_result result = detector->add(image_view::from_dib(p, twain_global_memory::size(h)));
+                    twain_global_memory::unlock(h);
+                    *current = { h, result.is_duplicate };
+                    std::lock_guard<std::mutex> lock(log->mutex);
+                    log->results.push_back(result);
+                }
+                if (notification == DTWAIN_TN_QUERYPAGEDISCARD && current->second && discard)
+                {
+                    // DTWAIN frees the page, so nothing may refer to it
+                    budget->release(h);
+                    page_spill_store::forget(h);
+                    page_compression_store::forget(h);
+                    *current = { nullptr, false };
+                    return 0;
+                }
+                return 1;
+            });
+        }
+
+        void remove_duplicate_page_filter()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_filters().erase(m_duplicate_page_log.get());
+        }
+
+        // Deskews each page in place as it arrives, if the device cannot deskew pages itself
+        void install_deskew_filter()
+        {
+            remove_deskew_filter();
+            const auto& ds = m_acquire_characteristics.get_deskew_options();
+            if (!m_pSession || !ds.is_enabled() || get_capability_interface().is_automaticdeskew_supported())
+                return;
+            auto deskewer = std::make_shared<page_deskewer>();
+            deskewer->set_max_angle(ds.get_max_angle()).set_min_angle(ds.get_min_angle()).set_verify(ds.get_verify());
+            std::shared_ptr<deskew_log> log = m_deskew_log;
+            {
+                std::lock_guard<std::mutex> lock(log->mutex);
+                log->results.clear();
+            }
+            DTWAIN_SOURCE source = m_theSource;
+            m_pSession->get_notification_filters().install(log.get(), notification_stage::deskew,
+                                                           [log, deskewer, source](WPARAM wParam, LPARAM lParam) -> LRESULT
+            {
+                if (!is_from_source(lParam, source))
+                    return 1;
+                if (static_cast<LONG>(wParam) != DTWAIN_TN_TRANSFERDONE)
+                    return 1;
+                HANDLE h = API_INSTANCE DTWAIN_GetCurrentAcquiredImage(source);
+                void* p = twain_global_memory::lock(h);
+                if (!p)
+                    return 1;
+                deskew_result result = deskewer->process(p, twain_global_memory::size(h));
+                twain_global_memory::unlock(h);
+                std::lock_guard<std::mutex> lock(log->mutex);
+                result.page_number = log->results.size();
+                log->results.push_back(result);
+                return 1;
+            });
+        }
+
+        void remove_deskew_filter()
+        {
+            if (m_pSession)
+                m_pSession->get_notification_filters().erase(m_deskew_log.get());
+        }
+
+        // Removes the hooks and filters that are installed for the duration of one acquisition
+        void remove_acquisition_hooks()
+        {
+            remove_memory_budget_hook();
+            remove_page_store_hook();
+            remove_blank_page_filter();
+            remove_thumbnail_filter();
+            remove_color_detection_filter();
+            remove_duplicate_page_filter();
+            remove_deskew_filter();
+        }
+
+        // Removes the acquisition's hooks and filters when acquire() returns, so that they never see the pages of a later
+        // acquisition of another kind.  A modeless acquisition is still running when acquire() returns, so its hooks are
+        // kept until the next acquisition starts, or the source is closed or detached.
+        struct acquisition_hooks_guard
+        {
+            twain_source* source;
+            bool keep;
+            acquisition_hooks_guard(twain_source* pSource, bool modeless) : source(pSource), keep(modeless) {}
+            acquisition_hooks_guard(const acquisition_hooks_guard&) = delete;
+            acquisition_hooks_guard& operator=(const acquisition_hooks_guard&) = delete;
+            ~acquisition_hooks_guard() { if (!keep) source->remove_acquisition_hooks(); }
+        };
+
         acquire_return_type acquire_to_image_handles(transfer_type transtype)
         {
             acquire_characteristics& ac = m_acquire_characteristics;
@@ -373,12 +1014,16 @@ namespace twain {
                 twain_array images(API_INSTANCE DTWAIN_CreateAcquisitionArray());
                 bool retval = false;
                 if (transtype == transfer_type::image_native)
+                {
+                    install_memory_budget_hook(0);
+                    install_page_store_hook();
                     retval = API_INSTANCE DTWAIN_AcquireNativeEx(m_theSource,
                                                     static_cast<LONG>(ct),
                                                     static_cast<LONG>(gOpts.get_max_pages()), 
                                                     ac.get_userinterface_options().is_shown(),
                                                     ac.get_general_options().get_source_action() == sourceaction_type::closeafteracquire, 
                                                     images.get_array(), nullptr) != 0;
+                }
                 else
                 {
                     // Set the compression type first, if it needs to be set
@@ -386,6 +1031,8 @@ namespace twain {
                     buffered_transfer_info& bt = get_buffered_transfer_info();
                     bt.init_transfer(
                         static_cast<compression_value::value_type>(m_capability_info.get_cap_values< ICAP_COMPRESSION_>(capability_interface::get_current()).front()));
+                    install_memory_budget_hook(static_cast<size_t>((std::max)(bt.stripsize(), 0L)));
+                    install_page_store_hook();
                     retval = API_INSTANCE DTWAIN_AcquireBufferedEx( m_theSource,
                                                         static_cast<LONG>(ct),
                                                         static_cast<LONG>(gOpts.get_max_pages()), 
@@ -398,17 +1045,16 @@ namespace twain {
                 if (retval || last_error == DTWAIN_NO_ERROR )
                    return { acquire_ok, std::move(images) };
                 else
-                    return { last_error, {} };
+                    return { last_error, twain_array() };
             }
-            return { acquire_canceled, {} };
+            return { acquire_canceled, twain_array() };
         }
 
         void wait_for_feeder(bool& status)
         {
             using namespace std::chrono_literals;
             // check for feeder stuff here
-            paperhandling_info paperinfo;
-            paperinfo.get_info(*this);
+            const paperhandling_info& paperinfo = get_paperhandling_info();
 
             bool isfeedersupported = paperinfo.is_feedersupported();
             if (!isfeedersupported)
@@ -541,9 +1187,12 @@ namespace twain {
         /// @note Once a twain_source is detached, the DTWAIN_SOURCE that was attached is still valid (not closed). 
         void detach()
         {
+            remove_acquisition_hooks();
             m_theSource = nullptr;
             m_bIsSelected = false;
             m_capability_info.detach();
+            m_capability_info.set_set_listener(nullptr);
+            invalidate_info();
         }
 
         template <typename T>
@@ -588,6 +1237,238 @@ namespace twain {
 
         buffered_transfer_info& get_buffered_transfer_info() noexcept { return m_buffered_info; }
 
+        /// Returns the memory budget for images acquired to memory.
+        ///
+        /// By default there is no limit.  When a limit is set with memory_budget::set_limit(), each page acquired with an
+        /// image transfer is charged to the budget, and the device is held at the transfer-ready handshake while the budget
+        /// is exhausted.  Applications release a page with memory_budget::release() when they free or hand off its HANDLE;
+        /// pages that are spilled or compressed are released (and charged again when they are restored).
+        /// memory_budget::get_stats() returns the current and peak usage.
+        /// @note A modal acquire() does not return until the acquisition ends, so the device is only held back if another thread
+        /// consumes and releases pages during the acquisition, and has registered with a memory_budget::consumer_scope.
+        /// @see get_shared_memory_budget()
+        memory_budget& get_memory_budget() noexcept { return *m_memory_budget; }
+
+        /// Returns the memory budget as a shared object, so that it can be used by threads that consume the acquired pages.
+        std::shared_ptr<memory_budget> get_shared_memory_budget() const noexcept { return m_memory_budget; }
+
+        /// Spills pages acquired to memory to a memory-mapped temporary file once more than **max_resident_bytes** are in memory.
+        ///
+        /// Only the pages of an image_handler returned by take_images() are spilled, since the handler restores a page before
+        /// every access.  The least recently used pages are spilled as pages are added to such handlers, and are restored one
+        /// at a time when they are accessed through the handler (image_handler::get_image_handle(), get_image_view() or
+        /// get_image_as_BMP()).  The HANDLE of a page does not change when it is spilled.  Pages that are still held by
+        /// DTWAIN, returned in the twain_array of acquire(), or returned by a twain_page_stream are never spilled.
+        /// @param[in] max_resident_bytes The bytes of acquired pages to keep in memory.  0 turns spilling off.
+        /// @param[in] directory The directory of the spill file.  If empty, the twain_session's temporary directory is used.
+        /// @returns **true** if spilling is off, or the spill file was created.
+        /// @note Turns off compression (see set_compression_policy()), since a page cannot be both spilled and compressed.
+        /// @see get_spill_store()
+        bool set_spill_policy(size_t max_resident_bytes, std::string directory = std::string())
+        {
+            m_spill_store.reset();
+            if (max_resident_bytes == 0)
+                return true;
+            set_compression_policy(false);
+            if (directory.empty() && m_pSession)
+                directory = m_pSession->get_twain_characteristics().get_temporary_directory();
+            m_spill_store = page_spill_store::create(max_resident_bytes, directory);
+            if (m_spill_store)
+                m_spill_store->set_memory_budget(m_memory_budget);
+            return m_spill_store != nullptr;
+        }
+
+        /// Returns the spill store set by set_spill_policy(), or **nullptr** if pages are not spilled
+        std::shared_ptr<page_spill_store> get_spill_store() const noexcept { return m_spill_store; }
+
+        /// Compresses pages acquired to memory on a background thread once they are owned by an image_handler.
+        ///
+        /// 1-bit pages are run-length encoded, and gray and color pages are compressed with an LZ4-class codec.  Only the
+        /// pages of an image_handler returned by take_images() are compressed, since the handler restores a page before
+        /// every access.  A page is decompressed when it is accessed through the handler, and its HANDLE does not change.
+        /// Pages that are still held by DTWAIN, returned in the twain_array of acquire(), or returned by a
+        /// twain_page_stream are never compressed.  Document pages typically compress 10 to 50 times.
+        /// @param[in] enable **true** to compress pages, **false** to stop compressing new pages.  Pages already compressed are still decompressed when they are accessed.
+        /// @note Turns off spilling (see set_spill_policy()), since a page cannot be both spilled and compressed.
+        /// @see get_compression_store()
+        twain_source& set_compression_policy(bool enable)
+        {
+            m_compression_store.reset();
+            if (enable)
+            {
+                set_spill_policy(0);
+                m_compression_store = page_compression_store::create();
+                m_compression_store->set_memory_budget(m_memory_budget);
+            }
+            return *this;
+        }
+
+        /// Returns the scores of the pages examined by the vectorized blank page detector during the last acquisition.
+        ///
+        /// Pages are only scored if blank page detection is enabled with blankpage_detection_method::vectorized (see
+        /// blankpage_options).  Scores are in the order the pages arrived, and include the pages that were discarded.
+        std::vector<blank_page_score> get_blank_page_scores() const
+        {
+            std::lock_guard<std::mutex> lock(m_blank_page_log->mutex);
+            return m_blank_page_log->scores;
+        }
+
+        /// Makes a thumbnail of each page as it is transferred, before the page is saved or returned.
+        ///
+        /// Each thumbnail pixel is the average of a square box of page pixels, so the thumbnail keeps the page's aspect
+        /// ratio and fits within **max_width** x **max_height**.  Thumbnails are gray for bitonal and gray pages and
+        /// 24-bit color otherwise.
+        /// @param[in] max_width The largest thumbnail width.  0 turns thumbnails off.
+        /// @param[in] max_height The largest thumbnail height.  0 turns thumbnails off.
+        /// @see get_thumbnails() set_thumbnail_callback()
+        twain_source& set_thumbnail_size(int32_t max_width, int32_t max_height) noexcept
+        {
+            m_thumbnail_max_width = max_width;
+            m_thumbnail_max_height = max_height;
+            return *this;
+        }
+
+        /// Sets a function that is called with each thumbnail as soon as it is made, on the thread that runs the TWAIN loop
+        twain_source& set_thumbnail_callback(std::function<void(const thumbnail&)> callback)
+        {
+            std::lock_guard<std::mutex> lock(m_thumbnail_log->mutex);
+            m_thumbnail_log->callback = std::move(callback);
+            return *this;
+        }
+
+        /// Returns the thumbnails of the pages of the last acquisition, in the order the pages arrived
+        std::vector<thumbnail> get_thumbnails() const
+        {
+            std::lock_guard<std::mutex> lock(m_thumbnail_log->mutex);
+            return m_thumbnail_log->thumbnails;
+        }
+
+        /// Returns the classification of each page of the last acquisition, in the order the pages arrived.
+        ///
+        /// Pages are only classified if color detection is turned on (see colordetection_options).  Each entry holds
+        /// the file type suggested for the page, so that a batch can be saved with G4 for its text pages and JPEG for
+        /// its photos.  The file type of an acquisition to file is chosen once, before the acquisition starts, so the
+        /// suggestion is for the application to use when it saves the pages itself.
+        std::vector<page_color_info> get_page_color_info() const
+        {
+            std::lock_guard<std::mutex> lock(m_color_detection_log->mutex);
+            return m_color_detection_log->pages;
+        }
+
+        /// Returns the result of duplicate page detection for each page of the last acquisition, in the order the pages
+        /// arrived, including the pages that were discarded.
+        ///
+        /// Pages are only compared if duplicate page detection is enabled (see duplicatepage_options).  Each result
+        /// holds the page's hash and its distance to the closest of the recent pages.
+        std::vector<duplicate_page_result> get_duplicate_pages() const
+        {
+            std::lock_guard<std::mutex> lock(m_duplicate_page_log->mutex);
+            return m_duplicate_page_log->results;
+        }
+
+        /// Returns the result of software deskew for each page of the last acquisition, in the order the pages arrived.
+        ///
+        /// Pages are only deskewed in software if deskew_options is enabled and the device does not support
+        /// ICAP_AUTOMATICDESKEW.  Each result holds the measured skew and its resolution, the time taken to measure
+        /// and rotate the page, and, if verification is on, the skew left after rotation.
+        std::vector<deskew_result> get_deskew_results() const
+        {
+            std::lock_guard<std::mutex> lock(m_deskew_log->mutex);
+            return m_deskew_log->results;
+        }
+
+        /// Returns the compression store set by set_compression_policy(), or **nullptr** if pages are not compressed
+        std::shared_ptr<page_compression_store> get_compression_store() const noexcept { return m_compression_store; }
+
+        /// Writes each page acquired to memory to **store**, in addition to returning it in get_images().
+        ///
+        /// Pages already in the store are kept, and new acquisitions are numbered after the last one in the store.  The
+        /// store can be read back, by this or another process, with an image_handler constructed from the store.
+        /// @param[in] store An open mapped_page_store, or **nullptr** to stop writing pages.
+        /// @see get_page_store()
+        twain_source& set_page_store(std::shared_ptr<mapped_page_store> store)
+        {
+            remove_page_store_hook();
+            m_page_store = std::move(store);
+            return *this;
+        }
+
+        /// Returns the page store set by set_page_store(), or **nullptr** if pages are not written to a store
+        std::shared_ptr<mapped_page_store> get_page_store() const noexcept { return m_page_store; }
+
+        /// Sets the capabilities whose values are published for other threads.
+        ///
+        /// After the source is opened, after each capability that is successfully set, and after the capabilities are
+        /// negotiated for each acquisition, the values of the monitored capabilities are retrieved on the TWAIN thread in
+        /// one capability_snapshot and published.  The capabilities set for an acquisition are published once, when all
+        /// of them have been set.  By default no capabilities are monitored, and nothing is published.
+        /// @param[in] queries The capabilities to publish.  get_default_monitored_caps() returns the resolution, pixel type,
+        /// duplex and feeder capabilities.
+        twain_source& set_monitored_caps(std::vector<capability_query> queries)
+        {
+            m_monitored_caps = std::move(queries);
+            return *this;
+        }
+
+        const std::vector<capability_query>& get_monitored_caps() const noexcept { return m_monitored_caps; }
+
+        /// Retrieves and publishes the values of the monitored capabilities.  Must be called from the TWAIN thread.
+        /// @see set_monitored_caps() get_capability_state()
+        void publish_capability_state()
+        {
+            m_bPublishPending = false;
+            if (m_theSource && !m_monitored_caps.empty())
+                m_state_publisher->publish(m_capability_info.get_snapshot(m_monitored_caps));
+        }
+
+        /// Returns the publisher of the monitored capability state.
+        ///
+        /// The returned object can be passed to, and read from, any thread, without synchronizing with the TWAIN thread.
+        /// @see set_monitored_caps()
+        std::shared_ptr<const capability_state_publisher> get_capability_state() const noexcept { return m_state_publisher; }
+
+        /// Returns the cache of non-capability settings applied before each acquisition.
+        ///
+        /// Settings such as the PDF properties, blank page detection and the acquire area are only applied when they
+        /// differ from the values applied for the previous acquisition.  applied_settings_cache::get_elided_count()
+        /// returns the number of DTWAIN calls that were skipped.
+        const applied_settings_cache& get_applied_settings() const noexcept { return m_applied_settings; }
+
+        /// Returns the paper handling information of the device.
+        ///
+        /// The information is retrieved the first time it is requested after the source is opened, and is only retrieved
+        /// again if one of the capabilities in paperhandling_info::get_dependent_caps() is set to a different value.
+        /// @note Use paperhandling_info::is_feederloaded() to test the live state of the feeder.
+        const paperhandling_info& get_paperhandling_info()
+        {
+            auto& memo = m_paperhandling_info;
+            const auto generation = m_capability_info.get_cap_set_generation(paperhandling_info::get_dependent_caps());
+            if (!memo.is_valid || memo.generation != generation)
+            {
+                memo.info.get_info(*this);
+                memo.is_valid = true;
+                memo.generation = generation;
+            }
+            return memo.info;
+        }
+
+        /// Returns the file transfer information of the device.
+        ///
+        /// The information is retrieved the first time it is requested after the source is opened, and is only retrieved
+        /// again if one of the capabilities in file_transfer_info::get_dependent_caps() is set to a different value.
+        const file_transfer_info& get_file_transfer_info()
+        {
+            auto& memo = m_filetransfer_info;
+            const auto generation = m_capability_info.get_cap_set_generation(file_transfer_info::get_dependent_caps());
+            if (!memo.is_valid || memo.generation != generation)
+            {
+                memo.info = info_base::get_file_transfer_info(*this);
+                memo.is_valid = true;
+                memo.generation = generation;
+            }
+            return memo.info;
+        }
+
         /// Returns a const reference to the capability_interface of the twain_source.
         /// 
         /// The capability_interface allows an application to get, set, and query the capabilities that the attached DTWAIN_SOURCE has available.
@@ -597,6 +1478,28 @@ namespace twain {
         /// @note If no DTWAIN_SOURCE is attached, a const reference is still returned, but will only be operable once a DTWAIN_SOURCE is attached.
         const capability_interface& get_capability_interface() const noexcept { return m_capability_info; }
 
+        /// Returns the capability settings that would be made for the current acquire_characteristics.
+        /// 
+        /// The settings are only recorded, and no capability is set on or retrieved from the device.  Whether the device
+        /// supports a capability is taken from the list of capabilities retrieved when the source was opened, and settings
+        /// of capabilities that the device does not support are included.
+        /// @returns std::vector<capability_setting> in the order that the settings would be applied
+        std::vector<capability_setting> get_capability_settings()
+        {
+            std::vector<capability_setting> settings;
+            m_capability_info.begin_recording(&settings, true);
+            start_apply();
+            m_capability_info.end_recording();
+            return settings;
+        }
+
+        /// Returns a fingerprint of the capability settings that the current acquire_characteristics would make.
+        /// @see get_capability_settings()
+        uint64_t get_characteristics_fingerprint()
+        {
+            return capability_fingerprint(get_capability_settings());
+        }
+
         /// Starts the acquisition process of the twain_source.
         /// 
         /// @returns std::pair<int32_t, twain_array> where **first** is the return code, **second** is the twain_array of images
@@ -619,7 +1522,7 @@ namespace twain {
 
                     // timed out waiting for the feeder to be loaded, or device doesn't support feeder
                     if (!fstatus && !use_feeder_or_flatbed)
-                        return acquire_return_type{ acquire_timeout, {} };
+                        return acquire_return_type{ acquire_timeout, twain_array() };
                 }
 
                 // if we got a timeout on the feeder, but use flatbed as backup, disable the feeder and use the flatbed
@@ -634,6 +1537,14 @@ namespace twain {
             {
                 if (callback_proc(twain_listener_values::DTWAIN_PREACQUIRE_START, 0, reinterpret_cast<LONG64>(m_pSession)))
                 {
+                    // the hooks of a previous (modeless) acquisition are still installed until now
+                    remove_acquisition_hooks();
+                    acquisition_hooks_guard guard(this, m_pSession->get_twain_characteristics().is_custom_twain_loop());
+                    install_blank_page_filter();
+                    install_thumbnail_filter();
+                    install_color_detection_filter();
+                    install_duplicate_page_filter();
+                    install_deskew_filter();
                     const auto transtype = m_acquire_characteristics.get_general_options().get_transfer_type();
                     if (transtype == transfer_type::file_using_native ||
                         transtype == transfer_type::file_using_buffered ||
@@ -644,7 +1555,7 @@ namespace twain {
                 else
                     callback_proc(twain_listener_values::DTWAIN_PREACQUIRE_TERMINATE, 0, reinterpret_cast<LONG64>(m_pSession));
             }
-            return acquire_return_type{ acquire_canceled, {} };
+            return acquire_return_type{ acquire_canceled, twain_array() };
         }
 
         /// Displays the twain_source's user interface, but does not allow acquiring images.
@@ -769,6 +1680,23 @@ namespace twain {
             return ih;
         }
 
+        /// Returns an image_handler that takes ownership of the images of an acquisition by this source.
+        ///
+        /// As get_images(), but the handler releases the pages it destroys from the source's memory budget, and, if
+        /// spilling or compression is turned on (see set_spill_policy() and set_compression_policy()), spills or compresses
+        /// its pages.  Once the
+        /// images are taken, they must only be accessed through the handler, and not through the twain_array.
+        image_handler take_images(const twain_array& images) const
+        {
+            image_handler ih = get_images(images);
+            ih.set_memory_budget(m_memory_budget);
+            if (m_spill_store)
+                ih.set_spill_store(m_spill_store);
+            if (m_compression_store)
+                ih.set_compression_store(m_compression_store);
+            return ih;
+        }
+
         /// Opens the attached DTWAIN_SOURCE if it has been selected
         /// 
         /// Opens the attached DTWAIN_SOURCE if it has been selected.  This function is called automatically by twain_session::select_source() if the **open** parameter
@@ -783,6 +1711,7 @@ namespace twain {
                 {
                     get_source_info_internal();
                     attach(m_theSource);
+                    publish_capability_state();
                     return true;
                 }
             }
@@ -799,7 +1728,9 @@ namespace twain {
             if (m_theSource)
             {
                 bool retVal = API_INSTANCE DTWAIN_CloseSource(m_theSource) ? true : false;
+                remove_acquisition_hooks();
                 m_theSource = nullptr;
+                invalidate_info();
                 return retVal;
             }
             return false;
@@ -824,16 +1755,11 @@ namespace twain {
             return m_bCloseable;
         }
 
-        /// Returns whether the twain_source is in the acquisition process.
-        /// 
-        /// @returns **true** if the twain_source is still in the acquisition state, **false** otherwise.
-        /// @see acquire()
-        bool is_acquiring() const { return API_INSTANCE DTWAIN_IsSourceAcquiring(m_theSource) ? true : false; }
-
-        /// Returns whether the twain_source has the user interface displayed.
+        /// Returns the loop signal of the twain_session that this source belongs to.
         /// 
-        /// @returns **true** if the twain_source has the user interface displayed, **false** otherwise.
-        bool is_uienabled() const { return API_INSTANCE DTWAIN_IsUIEnabled(get_source()) ? true : false; }
+        /// @returns the signal, or **nullptr** if the source was not selected from a twain_session.
+        /// @see twain_loop_adaptive
+        twain_loop_signal* get_loop_signal() noexcept override { return m_pSession ? &m_pSession->get_loop_signal() : nullptr; }
 
 
         /**
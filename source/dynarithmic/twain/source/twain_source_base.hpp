@@ -23,6 +23,7 @@ OF THIRD PARTY RIGHTS.
 
 #include <dynarithmic/twain/acquire_characteristics.hpp>
 #include <dynarithmic/twain/capability_interface.hpp>
+#include <dynarithmic/twain/messaging/twain_loop_signal.hpp>
 
 namespace dynarithmic {
 namespace twain {
@@ -67,6 +68,21 @@ namespace twain {
                 \returns **true** if the twain_source has the user interface displayed, **false** otherwise.
                 */
             bool is_uionlyenabled() const noexcept { return m_bUIOnlyOn; }
+
+            /// Returns whether the twain_source is in the acquisition process.
+            /// 
+            /// @returns **true** if the twain_source is still in the acquisition state, **false** otherwise.
+            /// @see twain_source::acquire()
+            bool is_acquiring() const { return API_INSTANCE DTWAIN_IsSourceAcquiring(m_theSource) ? true : false; }
+
+            /// Returns whether the twain_source has the user interface displayed.
+            /// 
+            /// @returns **true** if the twain_source has the user interface displayed, **false** otherwise.
+            bool is_uienabled() const { return API_INSTANCE DTWAIN_IsUIEnabled(m_theSource) ? true : false; }
+
+            /// Returns the signal used to wake a message loop that is waiting for TWAIN activity on this source.
+            /// @returns **nullptr** if the source is not associated with a twain_session.
+            virtual twain_loop_signal* get_loop_signal() noexcept { return nullptr; }
             void set_uionlyenabled(bool bSet) noexcept { m_bUIOnlyOn = bSet; }
     };
 }
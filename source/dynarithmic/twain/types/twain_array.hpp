@@ -23,6 +23,8 @@ OF THIRD PARTY RIGHTS.
 
 #include <array>
 #include <algorithm>
+#include <unordered_map>
+#include <vector>
 #include <dtwain.h>
 #include <dynarithmic/twain/types/twain_frame.hpp>
 #include <dynarithmic/twain/dtwain_twain.hpp>
@@ -70,44 +72,58 @@ namespace dynarithmic
                     m_isRange = API_INSTANCE DTWAIN_RangeIsValid(a, &nStatus) ? true : false;
                 }
 
-                twain_array(const twain_array& rhs)
-                {
-                    if (rhs.m_theArray)
-                        m_theArray = API_INSTANCE DTWAIN_ArrayCreateCopy(rhs.m_theArray);
-                    m_isRange = rhs.m_isRange;
-                }
+                // twain_array is move-only.  Use clone() when a deep copy of the underlying DTWAIN_ARRAY is required.
+                twain_array(const twain_array&) = delete;
+                twain_array& operator=(const twain_array&) = delete;
 
-                twain_array(twain_array&& rhs) noexcept
+                twain_array(twain_array&& rhs) noexcept : m_theArray(rhs.m_theArray), m_isRange(rhs.m_isRange)
                 {
-                    m_theArray = rhs.m_theArray;
-                    m_isRange = rhs.m_isRange;
                     rhs.m_theArray = nullptr;
+                    rhs.m_isRange = false;
                 }
 
                 twain_array& operator=(twain_array&& rhs) noexcept
-                {
-                    swap(*this, rhs);
-                    rhs.m_theArray = nullptr;
-                    return *this;
-                }
-
-                twain_array& operator=(const twain_array& rhs)
                 {
                     if (&rhs != this)
                     {
-                        auto temp(rhs);
-                        swap(temp, *this);
+                        reset();
+                        swap(*this, rhs);
                     }
                     return *this;
                 }
 
+                twain_array clone() const
+                {
+                    twain_array ret;
+                    if (m_theArray)
+                        ret.m_theArray = API_INSTANCE DTWAIN_ArrayCreateCopy(m_theArray);
+                    ret.m_isRange = m_isRange;
+                    return ret;
+                }
+
                 void swap(twain_array& t1, twain_array& t2) const
                 {
                     std::swap(t1.m_theArray, t2.m_theArray);
                     std::swap(t1.m_isRange, t2.m_isRange);
                 }
 
-                void set_array(DTWAIN_ARRAY a) { m_theArray = a; m_isRange = API_INSTANCE DTWAIN_RangeIsValid(a, nullptr)?true:false; }
+                void reset()
+                {
+                    if (m_theArray)
+                        API_INSTANCE DTWAIN_ArrayDestroy(m_theArray);
+                    m_theArray = nullptr;
+                    m_isRange = false;
+                }
+
+                DTWAIN_ARRAY release() noexcept
+                {
+                    DTWAIN_ARRAY a = m_theArray;
+                    m_theArray = nullptr;
+                    m_isRange = false;
+                    return a;
+                }
+
+                void set_array(DTWAIN_ARRAY a) { if (a != m_theArray) reset(); m_theArray = a; m_isRange = API_INSTANCE DTWAIN_RangeIsValid(a, nullptr)?true:false; }
                 void resize(size_t n) const { if (m_theArray) API_INSTANCE DTWAIN_ArrayResize(m_theArray, static_cast<LONG>(n)); }
                 bool is_range() const { return m_isRange; }
 
@@ -128,8 +144,7 @@ namespace dynarithmic
                         DTWAIN_ARRAY temp;
                         if (API_INSTANCE DTWAIN_RangeExpand(m_theArray, &temp))
                         {
-                            const twain_array temp_arr(temp);
-                            *this = temp_arr;
+                            *this = twain_array(temp);
                             return true;
                         }
                     }
@@ -237,14 +252,23 @@ namespace dynarithmic
                 copy_from_twain_array(ta, ta.get_count(), C);
             }
 
+            template <typename Container, typename std::enable_if<
+                            std::is_floating_point<typename Container::value_type>::value ||
+                            std::is_integral<typename Container::value_type>::value, bool>::type = 1>
+            static void fill_twain_array(twain_array& ta, const Container& C)
+            {
+                auto pBuffer = reinterpret_cast<dtwain_underlying_type<Container::value_type>::value_type*>(API_INSTANCE DTWAIN_ArrayGetBuffer(ta.get_array(), 0));
+                if (pBuffer)
+                    std::copy(C.begin(), C.end(), pBuffer);
+            }
+
             template <typename Container, typename std::enable_if<
                             std::is_floating_point<typename Container::value_type>::value ||
                             std::is_integral<typename Container::value_type>::value, bool>::type = 1>
             static void copy_to_twain_array(DTWAIN_SOURCE theSource, twain_array& ta, int cap_value, const Container& C)
             {
                 ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, static_cast<LONG>(C.size())));
-                auto pBuffer = reinterpret_cast<dtwain_underlying_type<Container::value_type>::value_type*>(API_INSTANCE DTWAIN_ArrayGetBuffer(ta.get_array(), 0));
-                std::copy(C.begin(), C.end(), pBuffer);
+                fill_twain_array(ta, C);
             }
 
             template <typename T, typename Container, typename std::enable_if<
@@ -258,9 +282,8 @@ namespace dynarithmic
 
             template <typename Container, typename std::enable_if<
                             std::is_same<typename Container::value_type, std::string>::value, bool>::type = 1>
-            static void copy_to_twain_array(DTWAIN_SOURCE theSource, twain_array& ta, int cap_value, const Container& C)
+            static void fill_twain_array(twain_array& ta, const Container& C)
             {
-                ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, C.size()));
                 long i = 0;
                 std::for_each(C.begin(), C.end(), [&](const std::string& s)
                 {
@@ -269,6 +292,14 @@ namespace dynarithmic
                 });
             }
 
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, std::string>::value, bool>::type = 1>
+            static void copy_to_twain_array(DTWAIN_SOURCE theSource, twain_array& ta, int cap_value, const Container& C)
+            {
+                ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, static_cast<LONG>(C.size())));
+                fill_twain_array(ta, C);
+            }
+
             template <typename T, typename Container,
                         typename std::enable_if<std::is_same<typename Container::value_type, std::string>::value, bool>::
                         type = 1>
@@ -277,13 +308,24 @@ namespace dynarithmic
                 copy_to_twain_array(theSource, ta, T::cap_value, C);
             }
 
+            template <typename Container, typename std::enable_if<
+                            std::is_same<typename Container::value_type, twain_frame<>>::value, bool>::type = 1>
+            static void fill_twain_array(twain_array& ta, const Container& C)
+            {
+                LONG i = 0;
+                for (auto& frm : C)
+                {
+                    API_INSTANCE DTWAIN_ArrayFrameSetAt(ta.get_array(), i, frm.left, frm.top, frm.right, frm.bottom);
+                    ++i;
+                }
+            }
+
             template <typename Container, typename std::enable_if<
                             std::is_same<typename Container::value_type, twain_frame<>>::value, bool>::type = 1>
             static void copy_to_twain_array(DTWAIN_SOURCE theSource, twain_array& ta, int cap_value, const Container& C)
             {
-                ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, C.size()));
-                for (size_t i = 0; i < C.size(); ++i)
-                    API_INSTANCE DTWAIN_ArrayFrameSetAt(ta.get_array(), static_cast<LONG>(i), C[i].left, C[i].top, C[i].right, C[i].bottom);
+                ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, static_cast<LONG>(C.size())));
+                fill_twain_array(ta, C);
             }
 
             template <typename T, typename Container, typename std::enable_if<
@@ -294,6 +336,125 @@ namespace dynarithmic
             }
         };
 
+        /// Pool of reusable DTWAIN arrays, keyed by the DTWAIN array type that a capability requires.
+        ///
+        /// Setting a capability requires a DTWAIN_ARRAY of the correct type (LONG, floating point, string, frame).  Instead of
+        /// creating and destroying an array on each set, the twain_array_pool hands out an array of the required type and size
+        /// from its free list, and takes the array back when the lease goes out of scope.
+        /// @note Each twain_source (through its capability_interface) owns its own pool.  The pool is not thread-safe.
+        class twain_array_pool
+        {
+            public:
+                class lease
+                {
+                    twain_array_pool* m_pPool = nullptr;
+                    LONG m_arrayType = 0;
+                    twain_array m_array;
+
+                    public:
+                        lease() = default;
+                        lease(twain_array_pool* pool, LONG array_type, twain_array&& arr) noexcept :
+                                m_pPool(pool), m_arrayType(array_type), m_array(std::move(arr)) {}
+                        lease(lease&& rhs) noexcept : m_pPool(rhs.m_pPool), m_arrayType(rhs.m_arrayType), m_array(std::move(rhs.m_array))
+                        { rhs.m_pPool = nullptr; }
+                        lease& operator=(lease&& rhs) noexcept
+                        {
+                            if (&rhs != this)
+                            {
+                                give_back();
+                                m_pPool = rhs.m_pPool;
+                                m_arrayType = rhs.m_arrayType;
+                                m_array = std::move(rhs.m_array);
+                                rhs.m_pPool = nullptr;
+                            }
+                            return *this;
+                        }
+                        lease(const lease&) = delete;
+                        lease& operator=(const lease&) = delete;
+                        ~lease() { give_back(); }
+
+                        twain_array& get() noexcept { return m_array; }
+                        DTWAIN_ARRAY get_array() const noexcept { return m_array.get_array(); }
+                        explicit operator bool() const noexcept { return m_array.get_array() != nullptr; }
+
+                    private:
+                        void give_back()
+                        {
+                            if (m_pPool)
+                                m_pPool->release(m_arrayType, std::move(m_array));
+                            m_pPool = nullptr;
+                        }
+                };
+
+                struct pool_stats
+                {
+                    uint64_t arrays_created = 0;
+                    uint64_t arrays_reused = 0;
+                };
+
+                explicit twain_array_pool(size_t max_per_type = 4) : m_nMaxPerType(max_per_type) {}
+                twain_array_pool(twain_array_pool&&) = default;
+                twain_array_pool& operator=(twain_array_pool&&) = default;
+                twain_array_pool(const twain_array_pool&) = delete;
+                twain_array_pool& operator=(const twain_array_pool&) = delete;
+
+                /// Borrows an array suitable for setting capability **cap_value**, sized to hold **num_items** items.
+                ///
+                /// @returns a lease that returns the array to the pool when destroyed.  If no array could be obtained, the lease is empty.
+                lease acquire(DTWAIN_SOURCE theSource, int cap_value, size_t num_items)
+                {
+                    const LONG array_type = get_array_type(theSource, cap_value);
+                    auto& free_list = m_freeLists[array_type];
+                    if (!free_list.empty())
+                    {
+                        twain_array ta(std::move(free_list.back()));
+                        free_list.pop_back();
+                        ta.resize(num_items);
+                        ++m_stats.arrays_reused;
+                        return lease(this, array_type, std::move(ta));
+                    }
+                    twain_array ta;
+                    ta.set_array(API_INSTANCE DTWAIN_ArrayCreateFromCap(theSource, cap_value, static_cast<LONG>(num_items)));
+                    if (!ta.get_array())
+                        return lease();
+                    ++m_stats.arrays_created;
+                    return lease(this, array_type, std::move(ta));
+                }
+
+                /// Destroys all arrays currently held by the pool.
+                void clear()
+                {
+                    m_freeLists.clear();
+                    m_arrayTypes.clear();
+                }
+
+                const pool_stats& get_stats() const noexcept { return m_stats; }
+
+            private:
+                void release(LONG array_type, twain_array&& ta)
+                {
+                    if (!ta.get_array())
+                        return;
+                    auto& free_list = m_freeLists[array_type];
+                    if (free_list.size() < m_nMaxPerType)
+                        free_list.push_back(std::move(ta));
+                }
+
+                LONG get_array_type(DTWAIN_SOURCE theSource, int cap_value)
+                {
+                    auto iter = m_arrayTypes.find(cap_value);
+                    if (iter != m_arrayTypes.end())
+                        return iter->second;
+                    const LONG array_type = API_INSTANCE DTWAIN_GetCapArrayType(theSource, cap_value);
+                    m_arrayTypes.insert({ cap_value, array_type });
+                    return array_type;
+                }
+
+                std::unordered_map<LONG, std::vector<twain_array>> m_freeLists;
+                std::unordered_map<int, LONG> m_arrayTypes;
+                size_t m_nMaxPerType;
+                pool_stats m_stats;
+        };
     }
 }
 #endif
@@ -0,0 +1,96 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_GLOBAL_MEMORY_HPP
+#define DTWAIN_TWAIN_GLOBAL_MEMORY_HPP
+
+#include <cstddef>
+#include <dtwain.h>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// Access to the global memory blocks (DIB handles) that DTWAIN returns for acquired pages.
+        ///
+        /// Outside of Windows there are no global memory blocks: lock() returns nullptr and size() returns 0, so callers
+        /// skip the page.
+        struct twain_global_memory
+        {
+            static void* lock(HANDLE h)
+            {
+                #ifdef _WIN32
+                return h ? ::GlobalLock(h) : nullptr;
+                #else
+                (void)h;
+                return nullptr;
+                #endif
+            }
+
+            static void unlock(HANDLE h)
+            {
+                #ifdef _WIN32
+                ::GlobalUnlock(h);
+                #else
+                (void)h;
+                #endif
+            }
+
+            static size_t size(HANDLE h)
+            {
+                #ifdef _WIN32
+                return static_cast<size_t>(::GlobalSize(h));
+                #else
+                (void)h;
+                return 0;
+                #endif
+            }
+
+            /// Returns **true** if **h** is a moveable block, which keeps its handle when it is resized.  **h** must be
+            /// locked, and **p** is the address returned by lock().
+            /// @note A fixed block reports a lock count of 0 even while it is locked, and its handle is its address.
+            static bool is_moveable(HANDLE h, const void* p)
+            {
+                #ifdef _WIN32
+                const UINT flags = ::GlobalFlags(h);
+                return p && flags != GMEM_INVALID_HANDLE && (flags & GMEM_LOCKCOUNT) != 0 && ::GlobalHandle(p) == h;
+                #else
+                (void)h;
+                (void)p;
+                return false;
+                #endif
+            }
+
+            /// Resizes the unlocked moveable block **h** to **new_size** bytes.
+            /// @returns **true** if the block was resized and kept its handle.  Otherwise the block is left as it was.
+            static bool resize(HANDLE h, size_t new_size)
+            {
+                #ifdef _WIN32
+                return ::GlobalReAlloc(h, new_size, GMEM_MOVEABLE) == h;
+                #else
+                (void)h;
+                (void)new_size;
+                return false;
+                #endif
+            }
+        };
+    }
+}
+#endif
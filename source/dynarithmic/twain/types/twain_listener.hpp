@@ -25,28 +25,98 @@ OF THIRD PARTY RIGHTS.
 #ifndef DTWAIN_TWAIN_LISTENER_HPP
 #define DTWAIN_TWAIN_LISTENER_HPP
 
-#include <unordered_map>
 #include <dtwain.h>
 #include <dynarithmic/twain/twain_values.hpp>
 #include <dynarithmic/twain/source/twain_source_base.hpp>
+
+// List of the notification ids and the twain_listener function that handles each one.  Used to build the listener
+// dispatch table, and the compile-time dispatch of twain_listener_crtp.
+#define DTWAIN_LISTENER_HANDLERS(X) \
+    X(twain_listener_values::DTWAIN_PREACQUIRE_START, preacquire) \
+    X(twain_listener_values::DTWAIN_PREACQUIRE_TERMINATE, preacquire_terminate) \
+    X(DTWAIN_TN_ACQUIREDONE, acquiredone) \
+    X(DTWAIN_TN_ACQUIREFAILED, acquirefailed) \
+    X(DTWAIN_TN_ACQUIRECANCELLED, acquirecancelled) \
+    X(DTWAIN_TN_ACQUIRESTARTED, acquirestarted) \
+    X(DTWAIN_TN_PAGECONTINUE, pagecontinue) \
+    X(DTWAIN_TN_PAGEFAILED, pagefailed) \
+    X(DTWAIN_TN_PAGECANCELLED, pagecancelled) \
+    X(DTWAIN_TN_TRANSFERREADY, transferready) \
+    X(DTWAIN_TN_TRANSFERDONE, transferdone) \
+    X(DTWAIN_TN_UICLOSING, uiclosing) \
+    X(DTWAIN_TN_UICLOSED, uiclosed) \
+    X(DTWAIN_TN_UIOPENED, uiopened) \
+    X(DTWAIN_TN_CLIPTRANSFERDONE, cliptransferdone) \
+    X(DTWAIN_TN_INVALIDIMAGEFORMAT, invalidimageformat) \
+    X(DTWAIN_TN_ACQUIRETERMINATED, acquireterminated) \
+    X(DTWAIN_TN_TRANSFERSTRIPREADY, transferstripready) \
+    X(DTWAIN_TN_TRANSFERSTRIPDONE, transferstripdone) \
+    X(DTWAIN_TN_TRANSFERSTRIPFAILED, transferstripfailed) \
+    X(DTWAIN_TN_IMAGEINFOERROR, imageinfoerror) \
+    X(DTWAIN_TN_TRANSFERCANCELLED, transfercancelled) \
+    X(DTWAIN_TN_FILESAVECANCELLED, filesavecancelled) \
+    X(DTWAIN_TN_FILESAVEOK, filesaveok) \
+    X(DTWAIN_TN_FILESAVEERROR, filesaveerror) \
+    X(DTWAIN_TN_FILEPAGESAVEOK, filepagesaveok) \
+    X(DTWAIN_TN_FILEPAGESAVEERROR, filepagesaveerror) \
+    X(DTWAIN_TN_PROCESSEDDIB, processeddib) \
+    X(DTWAIN_TN_DEVICEEVENT, deviceevent) \
+    X(DTWAIN_TN_ENDOFJOBDETECTED, eojdetected) \
+    X(DTWAIN_TN_EOJDETECTED_XFERDONE, eojdetectedtransferdone) \
+    X(DTWAIN_TN_TWAINPAGECANCELLED, twainpagecancelled) \
+    X(DTWAIN_TN_TWAINPAGEFAILED, twainpagefailed) \
+    X(DTWAIN_TN_QUERYPAGEDISCARD, querypagediscard) \
+    X(DTWAIN_TN_PAGEDISCARDED, pagediscarded) \
+    X(DTWAIN_TN_APPUPDATEDDIB, appupdateddib) \
+    X(DTWAIN_TN_FILEPAGESAVING, filepagesaving) \
+    X(DTWAIN_TN_PROCESSEDDIBFINAL, processeddibfinal) \
+    X(DTWAIN_TN_MANDUPSIDE1START, manualduplexside1start) \
+    X(DTWAIN_TN_MANDUPSIDE2START, manualduplexside2start) \
+    X(DTWAIN_TN_MANDUPSIDE1DONE, manualduplexside1done) \
+    X(DTWAIN_TN_MANDUPSIDE2DONE, manualduplexside2done) \
+    X(DTWAIN_TN_MANDUPMERGEERROR, manualduplexmergeerror) \
+    X(DTWAIN_TN_MANDUPPAGECOUNTERROR, manualduplexcounterror) \
+    X(DTWAIN_TN_MANDUPMEMORYERROR, manualduplexmemoryerror) \
+    X(DTWAIN_TN_MANDUPFILEERROR, manualduplexfileerror) \
+    X(DTWAIN_TN_MANDUPFILESAVEERROR, manualduplexfilesaveerror) \
+    X(DTWAIN_TN_BLANKPAGEDETECTED1, blankpagedetected1) \
+    X(DTWAIN_TN_BLANKPAGEDETECTED2, blankpagedetected2) \
+    X(DTWAIN_TN_BLANKPAGEDISCARDED1, blankpagediscarded1) \
+    X(DTWAIN_TN_BLANKPAGEDISCARDED2, blankpagediscarded2) \
+    X(DTWAIN_TN_FILENAMECHANGING, filenamechanging) \
+    X(DTWAIN_TN_FILENAMECHANGED, filenamechanged) \
+    X(DTWAIN_TN_UIOPENFAILURE, uiopenfailure)
+
 namespace dynarithmic
 {
     namespace twain
     {
         class twain_source;
+        struct twain_listener_handlers;
+        struct twain_listener_dispatch;
+
         class twain_listener
         {
-            private:
+            friend struct twain_listener_handlers;
+            friend struct twain_listener_dispatch;
+
+            public:
                 typedef int (twain_listener::*twain_listener_func)(twain_source&);
                 typedef LRESULT (twain_listener::*twain_error_func)(LONG, LONG);
-                using twain_listener_map = std::unordered_map<LONG, twain_listener_func>;
-    
+                typedef LRESULT (*twain_dispatch_func)(twain_listener&, WPARAM, LPARAM, twain_source&);
+
+            private:
                 LONG m_UserData;
                 bool m_bDefaultHandler;
                 LONG m_nNotificationID;
-                twain_listener_map m_listenerMap;
-    
+                twain_dispatch_func m_pDispatch;
+
+                static LRESULT table_dispatch(twain_listener& listener, WPARAM wParm, LPARAM lParm, twain_source& source);
+
             protected:
+                explicit twain_listener(twain_dispatch_func pDispatch) : m_UserData(0), m_bDefaultHandler(false), m_nNotificationID(0),
+                                                                         m_pDispatch(pDispatch) {}
+
                 virtual bool starthandler(twain_source&, WPARAM, LPARAM, int&) { return true; }
                 virtual int preacquire(twain_source&)  { return 1; }
                 virtual int preacquire_terminate(twain_source&)  { return 1; }
@@ -105,80 +175,149 @@ namespace dynarithmic
                 virtual int filenamechanged(twain_source&) { return 1; }
     
             public:
-                twain_listener() : m_UserData(0), m_bDefaultHandler(false), m_nNotificationID(0), m_listenerMap({
-                    {twain_listener_values::DTWAIN_PREACQUIRE_START, &twain_listener::preacquire},
-                    { twain_listener_values::DTWAIN_PREACQUIRE_TERMINATE, &twain_listener::preacquire_terminate},
-                    {DTWAIN_TN_ACQUIREDONE, &twain_listener::acquiredone},
-                    {DTWAIN_TN_ACQUIREFAILED, &twain_listener::acquirefailed},
-                    {DTWAIN_TN_ACQUIRECANCELLED, &twain_listener::acquirecancelled},
-                    {DTWAIN_TN_ACQUIRESTARTED, &twain_listener::acquirestarted},
-                    {DTWAIN_TN_PAGECONTINUE, &twain_listener::pagecontinue},
-                    {DTWAIN_TN_PAGEFAILED, &twain_listener::pagefailed},
-                    {DTWAIN_TN_PAGECANCELLED, &twain_listener::pagecancelled},
-                    {DTWAIN_TN_TRANSFERREADY, &twain_listener::transferready},
-                    {DTWAIN_TN_TRANSFERDONE, &twain_listener::transferdone},
-                    {DTWAIN_TN_UICLOSING, &twain_listener::uiclosing},
-                    {DTWAIN_TN_UICLOSED, &twain_listener::uiclosed},
-                    {DTWAIN_TN_UIOPENED, &twain_listener::uiopened},
-                    {DTWAIN_TN_CLIPTRANSFERDONE, &twain_listener::cliptransferdone},
-                    {DTWAIN_TN_INVALIDIMAGEFORMAT, &twain_listener::invalidimageformat},
-                    {DTWAIN_TN_ACQUIRETERMINATED, &twain_listener::acquireterminated},
-                    {DTWAIN_TN_TRANSFERSTRIPREADY, &twain_listener::transferstripready},
-                    {DTWAIN_TN_TRANSFERSTRIPDONE, &twain_listener::transferstripdone},
-                    {DTWAIN_TN_TRANSFERSTRIPFAILED, &twain_listener::transferstripfailed},
-                    {DTWAIN_TN_IMAGEINFOERROR, &twain_listener::imageinfoerror},
-                    {DTWAIN_TN_TRANSFERCANCELLED, &twain_listener::transfercancelled},
-                    {DTWAIN_TN_FILESAVECANCELLED, &twain_listener::filesavecancelled},
-                    {DTWAIN_TN_FILESAVEOK, &twain_listener::filesaveok},
-                    {DTWAIN_TN_FILESAVEERROR, &twain_listener::filesaveerror},
-                    {DTWAIN_TN_FILEPAGESAVEOK, &twain_listener::filepagesaveok},
-                    {DTWAIN_TN_FILEPAGESAVEERROR, &twain_listener::filepagesaveerror},
-                    {DTWAIN_TN_PROCESSEDDIB, &twain_listener::processeddib},
-                    {DTWAIN_TN_DEVICEEVENT, &twain_listener::deviceevent},
-                    {DTWAIN_TN_ENDOFJOBDETECTED, &twain_listener::eojdetected},
-                    {DTWAIN_TN_EOJDETECTED_XFERDONE, &twain_listener::eojdetectedtransferdone},
-                    {DTWAIN_TN_TWAINPAGECANCELLED, &twain_listener::twainpagecancelled},
-                    {DTWAIN_TN_TWAINPAGEFAILED, &twain_listener::twainpagefailed},
-                    {DTWAIN_TN_QUERYPAGEDISCARD, &twain_listener::querypagediscard},
-                    {DTWAIN_TN_PAGEDISCARDED, &twain_listener::pagediscarded},
-                    {DTWAIN_TN_APPUPDATEDDIB, &twain_listener::appupdateddib},
-                    {DTWAIN_TN_FILEPAGESAVING, &twain_listener::filepagesaving},
-                    {DTWAIN_TN_PROCESSEDDIBFINAL, &twain_listener::processeddibfinal},
-                    {DTWAIN_TN_MANDUPSIDE1START, &twain_listener::manualduplexside1start},
-                    {DTWAIN_TN_MANDUPSIDE2START, &twain_listener::manualduplexside2start},
-                    {DTWAIN_TN_MANDUPSIDE1DONE, &twain_listener::manualduplexside1done},
-                    {DTWAIN_TN_MANDUPSIDE2DONE, &twain_listener::manualduplexside2done},
-                    {DTWAIN_TN_MANDUPMERGEERROR, &twain_listener::manualduplexmergeerror},
-                    {DTWAIN_TN_MANDUPPAGECOUNTERROR, &twain_listener::manualduplexcounterror},
-                    {DTWAIN_TN_MANDUPMEMORYERROR, &twain_listener::manualduplexmemoryerror},
-                    {DTWAIN_TN_MANDUPFILEERROR, &twain_listener::manualduplexfileerror},
-                    {DTWAIN_TN_MANDUPFILESAVEERROR, &twain_listener::manualduplexfilesaveerror},
-                    {DTWAIN_TN_BLANKPAGEDETECTED1, &twain_listener::blankpagedetected1},
-                    {DTWAIN_TN_BLANKPAGEDETECTED2, &twain_listener::blankpagedetected2},
-                    {DTWAIN_TN_BLANKPAGEDISCARDED1, &twain_listener::blankpagediscarded1},
-                    {DTWAIN_TN_BLANKPAGEDISCARDED2, &twain_listener::blankpagediscarded2},
-                    {DTWAIN_TN_FILENAMECHANGING, &twain_listener::filenamechanging},
-                    {DTWAIN_TN_FILENAMECHANGED, &twain_listener::filenamechanged},
-                    {DTWAIN_TN_UIOPENFAILURE, &twain_listener::uiopenfailure}
-                })
+                twain_listener() : m_UserData(0), m_bDefaultHandler(false), m_nNotificationID(0), m_pDispatch(&table_dispatch)
                 {}
     
                 LRESULT call_func(WPARAM wParm, LPARAM lParm, twain_source* pSource)
                 {
-                    // Always called when handler starts
-                    int status = 0;
                     m_nNotificationID = static_cast<LONG>(wParm);
-                    if (!starthandler(*pSource, wParm, lParm, status))
-                        return status;
-    
-                    const auto it = m_listenerMap.find(static_cast<LONG>(wParm));
-                    if (it != m_listenerMap.end())
-                        return (this->*((*it).second))(*pSource);
-                    return defaulthandler(*pSource, wParm, lParm, m_UserData);
+                    return m_pDispatch(*this, wParm, lParm, *pSource);
                 }
-    
+
+                LONG get_notification_id() const noexcept { return m_nNotificationID; }
+                LONG get_user_data() const noexcept { return m_UserData; }
+
                 virtual ~twain_listener() {}
         };
+
+        /// The notification ids and handlers of DTWAIN_LISTENER_HANDLERS, as a constant expression
+        struct twain_listener_handlers
+        {
+            using handler_type = twain_listener::twain_listener_func;
+
+            struct entry
+            {
+                LONG id;
+                handler_type handler;
+            };
+
+            #define DTWAIN_COUNT_HANDLER(id, fn) + 1
+            static constexpr size_t num_entries = 0 DTWAIN_LISTENER_HANDLERS(DTWAIN_COUNT_HANDLER);
+            #undef DTWAIN_COUNT_HANDLER
+
+            struct entry_list
+            {
+                entry entries[num_entries];
+            };
+
+            static constexpr entry_list get_entries()
+            {
+                return entry_list{ {
+                    #define DTWAIN_LIST_HANDLER(id, fn) { static_cast<LONG>(id), &twain_listener::fn },
+                    DTWAIN_LISTENER_HANDLERS(DTWAIN_LIST_HANDLER)
+                    #undef DTWAIN_LIST_HANDLER
+                } };
+            }
+
+            static constexpr LONG get_min_id()
+            {
+                LONG min_id = get_entries().entries[0].id;
+                for (size_t i = 1; i < num_entries; ++i)
+                    min_id = get_entries().entries[i].id < min_id ? get_entries().entries[i].id : min_id;
+                return min_id;
+            }
+
+            static constexpr LONG get_max_id()
+            {
+                LONG max_id = get_entries().entries[0].id;
+                for (size_t i = 1; i < num_entries; ++i)
+                    max_id = get_entries().entries[i].id > max_id ? get_entries().entries[i].id : max_id;
+                return max_id;
+            }
+        };
+
+        /// Maps notification ids to twain_listener functions.
+        ///
+        /// The table is built at compile time and shared by every twain_listener, so constructing a listener does not
+        /// allocate, and finding the handler for a notification is a single array index.
+        struct twain_listener_dispatch
+        {
+            using handler_type = twain_listener_handlers::handler_type;
+            static constexpr LONG min_id = twain_listener_handlers::get_min_id();
+            static constexpr size_t table_size = static_cast<size_t>(twain_listener_handlers::get_max_id() - min_id + 1);
+            static_assert(table_size <= 4096, "Notification ids are too sparse for a dispatch table");
+
+            struct table_type
+            {
+                handler_type handlers[table_size];
+            };
+
+            static constexpr table_type build_table()
+            {
+                table_type table{};
+                const auto list = twain_listener_handlers::get_entries();
+                for (size_t i = 0; i < twain_listener_handlers::num_entries; ++i)
+                    table.handlers[list.entries[i].id - twain_listener_handlers::get_min_id()] = list.entries[i].handler;
+                return table;
+            }
+
+            /// Returns the handler for notification **id**, or **nullptr** if there is no handler
+            static handler_type find(LONG id) noexcept
+            {
+                static constexpr table_type table = build_table();
+                const LONG index = id - twain_listener_handlers::get_min_id();
+                if (index < 0 || static_cast<size_t>(index) >= table_size)
+                    return nullptr;
+                return table.handlers[index];
+            }
+        };
+
+        inline LRESULT twain_listener::table_dispatch(twain_listener& listener, WPARAM wParm, LPARAM lParm, twain_source& source)
+        {
+            // Always called when handler starts
+            int status = 0;
+            if (!listener.starthandler(source, wParm, lParm, status))
+                return status;
+
+            const auto handler = twain_listener_dispatch::find(static_cast<LONG>(wParm));
+            if (handler)
+                return (listener.*handler)(source);
+            return listener.defaulthandler(source, wParm, lParm, listener.m_UserData);
+        }
+
+        /// Listener base class whose handlers are resolved at compile time.
+        ///
+        /// Derive **Listener** from twain_listener_crtp<Listener> and define the handlers that are needed, with the same names
+        /// and signatures as the twain_listener functions.  Each notification is dispatched with a switch to a non-virtual
+        /// call of **Listener**'s handler, or of the default twain_listener handler if **Listener** does not define one.
+        /// \code {.cpp}
+        ///     struct my_listener : twain_listener_crtp<my_listener>
+        ///     {
+        ///         int transferdone(twain_source& source) { /* ... */ return 1; }
+        ///     };
+        /// \endcode
+        /// @note The handlers must be public, or **Listener** must declare twain_listener_crtp<Listener> a friend.
+        template <typename Listener>
+        class twain_listener_crtp : public twain_listener
+        {
+            static LRESULT static_dispatch(twain_listener& listener, WPARAM wParm, LPARAM lParm, twain_source& source)
+            {
+                Listener& derived = static_cast<Listener&>(listener);
+                int status = 0;
+                if (!derived.Listener::starthandler(source, wParm, lParm, status))
+                    return status;
+                switch (static_cast<LONG>(wParm))
+                {
+                    #define DTWAIN_CASE_HANDLER(id, fn) case id: return derived.Listener::fn(source);
+                    DTWAIN_LISTENER_HANDLERS(DTWAIN_CASE_HANDLER)
+                    #undef DTWAIN_CASE_HANDLER
+                }
+                return derived.Listener::defaulthandler(source, wParm, lParm, derived.get_user_data());
+            }
+
+            public:
+                twain_listener_crtp() : twain_listener(&static_dispatch) {}
+        };
     }
 }
 #endif
@@ -0,0 +1,341 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_MAPPED_FILE_HPP
+#define DTWAIN_TWAIN_MAPPED_FILE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A file that is mapped into memory, and grows as data is appended to it.
+        ///
+        /// The file's capacity is grown in large steps, and the whole file is remapped when it grows, so pointers returned by
+        /// data() are only valid until the next append() or reserve().  A file opened with open_read_only() is mapped at its
+        /// current size, and is never grown, written or truncated, so that other processes can read a file that is still
+        /// being written.
+        class twain_mapped_file
+        {
+            public:
+                static constexpr uint64_t npos = static_cast<uint64_t>(-1);
+
+            private:
+                std::string m_path;
+                unsigned char* m_pData = nullptr;
+                uint64_t m_nSize = 0;
+                uint64_t m_nCapacity = 0;
+                bool m_bReadOnly = false;
+                #ifdef _WIN32
+                HANDLE m_hFile = INVALID_HANDLE_VALUE;
+                HANDLE m_hMapping = nullptr;
+                #else
+                int m_fd = -1;
+                #endif
+
+                static constexpr uint64_t min_capacity = 16 * 1024 * 1024;
+
+                void unmap()
+                {
+                    #ifdef _WIN32
+                    if (m_pData)
+                        ::UnmapViewOfFile(m_pData);
+                    if (m_hMapping)
+                        ::CloseHandle(m_hMapping);
+                    m_hMapping = nullptr;
+                    #else
+                    if (m_pData)
+                        ::munmap(m_pData, static_cast<size_t>(m_nCapacity));
+                    #endif
+                    m_pData = nullptr;
+                }
+
+                // maps **capacity** bytes of the file.  A writable file is first grown to **capacity**.
+                bool map(uint64_t capacity)
+                {
+                    #ifdef _WIN32
+                    m_hMapping = ::CreateFileMappingA(m_hFile, nullptr, m_bReadOnly ? PAGE_READONLY : PAGE_READWRITE,
+                                                      static_cast<DWORD>(capacity >> 32), static_cast<DWORD>(capacity & 0xFFFFFFFF), nullptr);
+                    if (!m_hMapping)
+                        return false;
+                    m_pData = static_cast<unsigned char*>(::MapViewOfFile(m_hMapping, m_bReadOnly ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS,
+                                                                          0, 0, static_cast<SIZE_T>(capacity)));
+                    #else
+                    if (!m_bReadOnly && ::ftruncate(m_fd, static_cast<off_t>(capacity)) != 0)
+                        return false;
+                    void* p = ::mmap(nullptr, static_cast<size_t>(capacity), m_bReadOnly ? PROT_READ : PROT_READ | PROT_WRITE,
+                                     MAP_SHARED, m_fd, 0);
+                    m_pData = (p == MAP_FAILED) ? nullptr : static_cast<unsigned char*>(p);
+                    #endif
+                    if (!m_pData)
+                    {
+                        unmap();
+                        return false;
+                    }
+                    m_nCapacity = capacity;
+                    return true;
+                }
+
+                static uint64_t get_file_size(const std::string& path)
+                {
+                    #ifdef _WIN32
+                    WIN32_FILE_ATTRIBUTE_DATA fad;
+                    if (!::GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &fad))
+                        return 0;
+                    return (static_cast<uint64_t>(fad.nFileSizeHigh) << 32) | fad.nFileSizeLow;
+                    #else
+                    struct stat st;
+                    if (::stat(path.c_str(), &st) != 0)
+                        return 0;
+                    return static_cast<uint64_t>(st.st_size);
+                    #endif
+                }
+
+            public:
+                twain_mapped_file() = default;
+                twain_mapped_file(const twain_mapped_file&) = delete;
+                twain_mapped_file& operator=(const twain_mapped_file&) = delete;
+                ~twain_mapped_file() { close(); }
+
+                /// Opens the file at **path** for writing, and maps it.
+                /// @param[in] path The file to open
+                /// @param[in] truncate If **true**, the file is created, or any existing contents are discarded.  If **false**,
+                /// the file must already exist.
+                /// @param[in] temporary If **true**, the file is deleted when it is closed (or when the process ends)
+                /// @returns **true** if the file was opened and mapped
+                bool open(std::string path, bool truncate, bool temporary)
+                {
+                    close();
+                    m_bReadOnly = false;
+                    const uint64_t existing = truncate ? 0 : get_file_size(path);
+                    #ifdef _WIN32
+                    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+                    if (temporary)
+                        flags = FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE;
+                    m_hFile = ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                            nullptr, truncate ? CREATE_ALWAYS : OPEN_EXISTING, flags, nullptr);
+                    if (m_hFile == INVALID_HANDLE_VALUE)
+                        return false;
+                    #else
+                    m_fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC | (truncate ? O_CREAT | O_TRUNC : 0), 0600);
+                    if (m_fd < 0)
+                        return false;
+                    if (temporary)
+                        ::unlink(path.c_str());
+                    #endif
+                    m_path = std::move(path);
+                    m_nSize = existing;
+                    if (!map(existing > min_capacity ? existing : static_cast<uint64_t>(min_capacity)))
+                    {
+                        close();
+                        return false;
+                    }
+                    return true;
+                }
+
+                /// Opens an existing file for reading only, and maps its current contents.
+                ///
+                /// The file is not created, grown or truncated, and bytes that another process appends after the file was
+                /// opened are not visible.
+                /// @returns **false** if the file does not exist, is empty, or could not be mapped
+                bool open_read_only(std::string path)
+                {
+                    close();
+                    m_bReadOnly = true;
+                    const uint64_t existing = get_file_size(path);
+                    if (existing == 0)
+                        return false;
+                    #ifdef _WIN32
+                    m_hFile = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                    if (m_hFile == INVALID_HANDLE_VALUE)
+                        return false;
+                    #else
+                    m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                    if (m_fd < 0)
+                        return false;
+                    #endif
+                    m_path = std::move(path);
+                    m_nSize = existing;
+                    if (!map(existing))
+                    {
+                        close();
+                        return false;
+                    }
+                    return true;
+                }
+
+                /// Unmaps and closes the file.  A file opened for writing is truncated to the bytes that were written.
+                void close()
+                {
+                    const bool was_open = is_open();
+                    unmap();
+                    #ifdef _WIN32
+                    if (m_hFile != INVALID_HANDLE_VALUE)
+                    {
+                        LARGE_INTEGER li;
+                        li.QuadPart = static_cast<LONGLONG>(m_nSize);
+                        if (!m_bReadOnly && ::SetFilePointerEx(m_hFile, li, nullptr, FILE_BEGIN))
+                            ::SetEndOfFile(m_hFile);
+                        ::CloseHandle(m_hFile);
+                    }
+                    m_hFile = INVALID_HANDLE_VALUE;
+                    #else
+                    if (m_fd >= 0)
+                    {
+                        if (!m_bReadOnly)
+                            (void)::ftruncate(m_fd, static_cast<off_t>(m_nSize));
+                        ::close(m_fd);
+                    }
+                    m_fd = -1;
+                    #endif
+                    if (was_open)
+                        m_nSize = m_nCapacity = 0;
+                }
+
+                bool is_open() const noexcept
+                {
+                    #ifdef _WIN32
+                    return m_hFile != INVALID_HANDLE_VALUE;
+                    #else
+                    return m_fd >= 0;
+                    #endif
+                }
+
+                /// Makes sure that the file can hold at least **capacity** bytes without being remapped
+                bool reserve(uint64_t capacity)
+                {
+                    if (!is_open() || (m_bReadOnly && capacity > m_nCapacity))
+                        return false;
+                    if (capacity <= m_nCapacity)
+                        return true;
+                    uint64_t new_capacity = m_nCapacity * 2;
+                    if (new_capacity < capacity)
+                        new_capacity = capacity;
+                    unmap();
+                    return map(new_capacity);
+                }
+
+                /// Appends **size** bytes to the end of the file.
+                /// @returns the offset of the data in the file, or npos if the file could not be grown.
+                uint64_t append(const void* data, size_t size)
+                {
+                    const uint64_t offset = m_nSize;
+                    if (!reserve(offset + size))
+                        return npos;
+                    if (size)
+                        std::memcpy(m_pData + offset, data, size);
+                    m_nSize += size;
+                    return offset;
+                }
+
+                /// Overwrites bytes that were written previously
+                bool write(uint64_t offset, const void* data, size_t size)
+                {
+                    if (!m_pData || m_bReadOnly || offset + size > m_nSize)
+                        return false;
+                    std::memcpy(m_pData + offset, data, size);
+                    return true;
+                }
+
+                bool read(uint64_t offset, void* data, size_t size) const
+                {
+                    if (!m_pData || offset + size > m_nSize)
+                        return false;
+                    std::memcpy(data, m_pData + offset, size);
+                    return true;
+                }
+
+                /// Discards the bytes after **size** (for example, a record that was not completely written)
+                bool truncate(uint64_t size)
+                {
+                    if (size > m_nSize)
+                        return false;
+                    m_nSize = size;
+                    return true;
+                }
+
+                /// Writes the modified pages of the mapping to the file
+                bool flush()
+                {
+                    if (!m_pData)
+                        return false;
+                    if (m_bReadOnly)
+                        return true;
+                    #ifdef _WIN32
+                    return ::FlushViewOfFile(m_pData, 0) && ::FlushFileBuffers(m_hFile);
+                    #else
+                    return ::msync(m_pData, static_cast<size_t>(m_nCapacity), MS_SYNC) == 0;
+                    #endif
+                }
+
+                unsigned char* data() noexcept { return m_pData; }
+                const unsigned char* data() const noexcept { return m_pData; }
+                uint64_t size() const noexcept { return m_nSize; }
+                uint64_t capacity() const noexcept { return m_nCapacity; }
+                bool is_read_only() const noexcept { return m_bReadOnly; }
+                const std::string& get_path() const noexcept { return m_path; }
+
+                /// Returns the directory used for temporary files when none is configured (the TEMP directory on Windows,
+                /// TMPDIR or /tmp elsewhere).
+                static std::string get_default_temp_directory()
+                {
+                    #ifdef _WIN32
+                    char buffer[MAX_PATH + 1] = {};
+                    const DWORD len = ::GetTempPathA(MAX_PATH, buffer);
+                    return std::string(buffer, len);
+                    #else
+                    const char* dir = std::getenv("TMPDIR");
+                    return dir && *dir ? dir : "/tmp";
+                    #endif
+                }
+
+                /// Returns a file name in **directory** that is unique to this process, starting with **prefix**
+                static std::string make_temp_path(std::string directory, const std::string& prefix)
+                {
+                    static std::atomic<unsigned> counter{ 0 };
+                    if (directory.empty())
+                        directory = get_default_temp_directory();
+                    if (directory.back() != '/' && directory.back() != '\\')
+                        directory += '/';
+                    #ifdef _WIN32
+                    const unsigned long pid = ::GetCurrentProcessId();
+                    #else
+                    const unsigned long pid = static_cast<unsigned long>(::getpid());
+                    #endif
+                    return directory + prefix + std::to_string(pid) + "_" + std::to_string(counter++) + ".tmp";
+                }
+        };
+    }
+}
+#endif
@@ -0,0 +1,88 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+#ifndef DTWAIN_TWAIN_MPSC_QUEUE_HPP
+#define DTWAIN_TWAIN_MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A lock-free, unbounded queue with multiple producers and a single consumer.
+        ///
+        /// push() can be called from any number of threads at the same time.  try_pop() must only be called from one
+        /// thread.  Producers never block each other or the consumer: each push() is a single atomic exchange.
+        /// @note try_pop() can return **false** for a short time while a push() on another thread is in progress.  The
+        /// consumer should try again later, rather than treating the queue as permanently empty.
+        template <typename T>
+        class twain_mpsc_queue
+        {
+            struct node
+            {
+                std::atomic<node*> next;
+                T value;
+                node() : next(nullptr), value() {}
+                explicit node(T&& v) : next(nullptr), value(std::move(v)) {}
+            };
+
+            std::atomic<node*> m_head;  // the most recently pushed node, updated by producers
+            node* m_tail;               // the node before the next one to pop, owned by the consumer
+            node m_stub;
+
+            public:
+                twain_mpsc_queue() : m_head(&m_stub), m_tail(&m_stub) {}
+                twain_mpsc_queue(const twain_mpsc_queue&) = delete;
+                twain_mpsc_queue& operator=(const twain_mpsc_queue&) = delete;
+
+                ~twain_mpsc_queue()
+                {
+                    T value;
+                    while (try_pop(value))
+                        ;
+                    if (m_tail != &m_stub)
+                        delete m_tail;
+                }
+
+                void push(T value)
+                {
+                    node* pNode = new node(std::move(value));
+                    node* pPrev = m_head.exchange(pNode, std::memory_order_acq_rel);
+                    pPrev->next.store(pNode, std::memory_order_release);
+                }
+
+                bool try_pop(T& value)
+                {
+                    node* pTail = m_tail;
+                    node* pNext = pTail->next.load(std::memory_order_acquire);
+                    if (!pNext)
+                        return false;
+                    value = std::move(pNext->value);
+                    m_tail = pNext;
+                    if (pTail != &m_stub)
+                        delete pTail;
+                    return true;
+                }
+        };
+    }
+}
+#endif
@@ -0,0 +1,118 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+
+#ifndef DTWAIN_TWAIN_SMALL_VECTOR_HPP
+#define DTWAIN_TWAIN_SMALL_VECTOR_HPP
+
+#include <array>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A container that stores up to N values inline, and only allocates memory when more than N values are added.
+        ///
+        /// Most capabilities are set with one, or a few, values.  A twain_small_vector can be used to build those values
+        /// without allocating memory, and can be passed wherever the capability_interface expects a container of values.
+        template <typename T, size_t N = 4>
+        class twain_small_vector
+        {
+            std::array<T, N> m_inline;
+            std::vector<T> m_overflow;
+            size_t m_size = 0;
+            bool m_bUseOverflow = false;
+
+            void move_to_overflow()
+            {
+                m_overflow.reserve(N * 2);
+                std::move(m_inline.begin(), m_inline.begin() + m_size, std::back_inserter(m_overflow));
+                m_bUseOverflow = true;
+            }
+
+            public:
+                typedef T value_type;
+                typedef size_t size_type;
+                typedef T& reference;
+                typedef const T& const_reference;
+                typedef T* iterator;
+                typedef const T* const_iterator;
+
+                twain_small_vector() = default;
+                twain_small_vector(std::initializer_list<T> il) { insert(end(), il.begin(), il.end()); }
+
+                template <typename Iter>
+                twain_small_vector(Iter first, Iter last) { insert(end(), first, last); }
+
+                void push_back(const T& value)
+                {
+                    if (!m_bUseOverflow && m_size == N)
+                        move_to_overflow();
+                    if (m_bUseOverflow)
+                        m_overflow.push_back(value);
+                    else
+                        m_inline[m_size] = value;
+                    ++m_size;
+                }
+
+                /// Inserts values at the end of the container.  This allows std::inserter to be used with a
+                /// twain_small_vector.
+                iterator insert(const_iterator, const T& value)
+                {
+                    push_back(value);
+                    return end() - 1;
+                }
+
+                template <typename Iter>
+                void insert(const_iterator, Iter first, Iter last)
+                {
+                    for (; first != last; ++first)
+                        push_back(*first);
+                }
+
+                void clear() noexcept
+                {
+                    m_overflow.clear();
+                    m_bUseOverflow = false;
+                    m_size = 0;
+                }
+
+                T* data() noexcept { return m_bUseOverflow ? m_overflow.data() : m_inline.data(); }
+                const T* data() const noexcept { return m_bUseOverflow ? m_overflow.data() : m_inline.data(); }
+                iterator begin() noexcept { return data(); }
+                iterator end() noexcept { return data() + m_size; }
+                const_iterator begin() const noexcept { return data(); }
+                const_iterator end() const noexcept { return data() + m_size; }
+                size_t size() const noexcept { return m_size; }
+                bool empty() const noexcept { return m_size == 0; }
+
+                /// Returns **true** if the values are stored inline, without any memory allocated
+                bool is_inline() const noexcept { return !m_bUseOverflow; }
+
+                T& operator[](size_t i) { return data()[i]; }
+                const T& operator[](size_t i) const { return data()[i]; }
+        };
+    }
+}
+#endif
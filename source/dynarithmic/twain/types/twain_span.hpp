@@ -0,0 +1,79 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+
+#ifndef DTWAIN_TWAIN_SPAN_HPP
+#define DTWAIN_TWAIN_SPAN_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace dynarithmic
+{
+    namespace twain
+    {
+        /// A non-owning, read-only view of contiguous capability values.
+        ///
+        /// A twain_span can be used wherever the capability_interface expects a container of values to set.  Unlike
+        /// std::vector, creating a twain_span from a braced list of values (for example, <b>{ DTWAIN_PT_RGB }</b>) does
+        /// not allocate memory.
+        /// @note A twain_span does not own its values.  A twain_span created from a braced list is only valid until the end
+        /// of the full expression it is created in, so it should only be used as a function argument.
+        template <typename T>
+        class twain_span
+        {
+            const T* m_pData = nullptr;
+            size_t m_size = 0;
+
+            template <typename Container>
+            using data_type = decltype(std::declval<const Container&>().data());
+
+            public:
+                typedef T value_type;
+                typedef size_t size_type;
+                typedef const T& reference;
+                typedef const T& const_reference;
+                typedef const T* iterator;
+                typedef const T* const_iterator;
+
+                twain_span() = default;
+                twain_span(const T* pData, size_t nCount) : m_pData(pData), m_size(nCount) {}
+                twain_span(std::initializer_list<T> il) : m_pData(il.begin()), m_size(il.size()) {}
+
+                /// Creates a view of a single value
+                static twain_span of(const T& value) { return twain_span(&value, 1); }
+
+                /// Creates a view of a contiguous container, such as std::vector, std::array or twain_small_vector
+                template <typename Container, typename std::enable_if<
+                                std::is_convertible<data_type<Container>, const T*>::value, bool>::type = 1>
+                twain_span(const Container& c) : m_pData(c.data()), m_size(c.size()) {}
+
+                const_iterator begin() const noexcept { return m_pData; }
+                const_iterator end() const noexcept { return m_pData + m_size; }
+                const T* data() const noexcept { return m_pData; }
+                size_t size() const noexcept { return m_size; }
+                bool empty() const noexcept { return m_size == 0; }
+                const T& operator[](size_t i) const { return m_pData[i]; }
+        };
+    }
+}
+#endif
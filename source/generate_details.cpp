@@ -35,10 +35,10 @@ std::string remove_quotes(std::string s)
 }
 
 template <typename T>
-void create_stream(std::stringstream& strm, const capability_interface& capInfo, int capValue)
+void create_stream(std::stringstream& strm, const capability_snapshot& capSnapshot, int capValue)
 {
     std::vector<T> imageVals;
-    imageVals = capInfo.get_cap_values<std::vector<T>>(capValue);
+    imageVals = capSnapshot.get<std::vector<T>>(capValue);
     if (imageVals.empty())
     {
         strm << "\"<not available>\"";
@@ -55,10 +55,10 @@ void create_stream(std::stringstream& strm, const capability_interface& capInfo,
     }
 }
 
-void create_stream_from_strings(std::stringstream& strm, const capability_interface& capInfo, int capValue)
+void create_stream_from_strings(std::stringstream& strm, const capability_snapshot& capSnapshot, int capValue)
 {
     std::vector<std::string> imageVals;
-    imageVals = capInfo.get_cap_values<std::vector<std::string>>(capValue);
+    imageVals = capSnapshot.get<std::vector<std::string>>(capValue);
     if (imageVals.empty())
     {
         strm << "\"<not available>\"";
@@ -76,10 +76,10 @@ void create_stream_from_strings(std::stringstream& strm, const capability_interf
 }
 
 template <typename T, typename S>
-void create_stream(std::stringstream& strm, const capability_interface& capInfo, int capValue, bool createStringNames)
+void create_stream(std::stringstream& strm, const capability_snapshot& capSnapshot, int capValue, bool createStringNames)
 {
     std::vector<T> imageVals;
-    imageVals = capInfo.get_cap_values<std::vector<T>>(capValue);
+    imageVals = capSnapshot.get<std::vector<T>>(capValue);
     if (imageVals.empty())
     {
         strm << "\"<not available>\"";
@@ -352,20 +352,25 @@ std::string generate_details()
                 std::string imageInfoCapsStr[] = { "\"brightness-values\":", "\"contrast-values\":", "\"gamma-values\":",
                     "\"highlight-values\":", "\"shadow-values\":", "\"threshold-values\":",
                     "\"rotation-values\":", "\"orientation-values\":", "\"overscan-values\":", "\"halftone-values\":" };
+
+                // query the image and device capabilities in one batch
+                const auto capSnapshot = capInfo.get_snapshot({ ICAP_BRIGHTNESS, ICAP_CONTRAST, ICAP_GAMMA, ICAP_HIGHLIGHT, ICAP_SHADOW,
+                                                                ICAP_THRESHOLD, ICAP_ROTATION, ICAP_ORIENTATION, ICAP_OVERSCAN, ICAP_HALFTONES,
+                                                                CAP_UICONTROLLABLE, CAP_PRINTER, CAP_JOBCONTROL });
                 for (int i = 0; i < sizeof(imageInfoCaps) / sizeof(imageInfoCaps[0]); ++i)
                 {
                     strm.str("");
                     strm << imageInfoCapsStr[i];
                     if (imageInfoCaps[i] == ICAP_ORIENTATION)
-                        create_stream<ICAP_ORIENTATION_::value_type>(strm, capInfo, ICAP_ORIENTATION);
+                        create_stream<ICAP_ORIENTATION_::value_type>(strm, capSnapshot, ICAP_ORIENTATION);
                     else
                     if (imageInfoCaps[i] == ICAP_OVERSCAN)
-                        create_stream<ICAP_OVERSCAN_::value_type, overscan_value>(strm, capInfo, ICAP_OVERSCAN, true);
+                        create_stream<ICAP_OVERSCAN_::value_type, overscan_value>(strm, capSnapshot, ICAP_OVERSCAN, true);
                     else
                     if (imageInfoCaps[i] == ICAP_HALFTONES)
-                        create_stream_from_strings(strm, capInfo, ICAP_HALFTONES);
+                        create_stream_from_strings(strm, capSnapshot, ICAP_HALFTONES);
                     else
-                        create_stream<double>(strm, capInfo, imageInfoCaps[i]);
+                        create_stream<double>(strm, capSnapshot, imageInfoCaps[i]);
                     imageInfoString[i] = strm.str();
                 }
 
@@ -445,7 +450,7 @@ std::string generate_details()
                 std::copy(deviceInfoString, deviceInfoString + sizeof(deviceInfoString) / sizeof(deviceInfoString[0]), deviceInfoCapsStr);
                 for (auto& s : deviceInfoCapsStr)
                     s.resize(s.size() - 5);
-                paperhandling_info pinfo(theSource);
+                const paperhandling_info& pinfo = theSource.get_paperhandling_info();
                 for (int i = 0; i < sizeof(deviceInfoCaps) / sizeof(deviceInfoCaps[0]); ++i)
                 {
                     if (i > 0)
@@ -456,20 +461,20 @@ std::string generate_details()
                     else
                     if (deviceInfoCaps[i] == CAP_UICONTROLLABLE)
                     {
-                        auto vValue = capInfo.get_uicontrollable();
+                        auto vValue = capSnapshot.get_values<CAP_UICONTROLLABLE_>();
                         if (!vValue.empty())
                             value = vValue.front();
                     }
                     else
                     if (deviceInfoCaps[i] == CAP_PRINTER)
                     {
-                        auto vValue = capInfo.get_printer();
+                        auto vValue = capSnapshot.get_values<CAP_PRINTER_>();
                         value = (!vValue.empty() && vValue.front() != TWDX_NONE);
                     }
                     else
                     if (deviceInfoCaps[i] == CAP_JOBCONTROL)
                     {
-                        auto vValue = capInfo.get_jobcontrol();
+                        auto vValue = capSnapshot.get_values<CAP_JOBCONTROL_>();
                         value = (!vValue.empty() && vValue.front() != TWJC_NONE);
                     }
                     else
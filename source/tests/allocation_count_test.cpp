@@ -0,0 +1,170 @@
+/*
+This file is part of the Dynarithmic TWAIN Library (DTWAIN).
+Copyright (c) 2002-2020 Dynarithmic Software.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+FOR ANY PART OF THE COVERED WORK IN WHICH THE COPYRIGHT IS OWNED BY
+DYNARITHMIC SOFTWARE. DYNARITHMIC SOFTWARE DISCLAIMS THE WARRANTY OF NON INFRINGEMENT
+OF THIRD PARTY RIGHTS.
+*/
+
+// Counts the heap allocations made by the wrapper when single capability values are set and retrieved.
+//
+// Setting a capability with a twain_span, and retrieving it into a twain_small_vector, must not allocate once the
+// source's twain_array pool is warmed up.  Allocations made inside the DTWAIN DLL use the DLL's own heap, and are not
+// counted.
+//
+// Build it like twainsave-opensource (same include paths, DTWAIN import library and preprocessor definitions), for
+// example:
+//     cl /std:c++17 /EHsc /I.. /I<boost> allocation_count_test.cpp <dtwain import library>
+// and run it with a TWAIN source installed (the TWAIN sample data source is enough).  The capability round trip is
+// skipped, and only the containers are checked, if no source can be opened.
+// Returns 0 if no unexpected allocation was made.
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <dynarithmic/twain/twain_source.hpp>
+
+namespace
+{
+    size_t s_nAllocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    ++s_nAllocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace dynarithmic::twain;
+
+namespace
+{
+    int s_nFailures = 0;
+
+    // Runs fn, and reports a failure if it made a different number of allocations than expected
+    template <typename Fn>
+    void expect_allocations(const char* name, size_t expected, Fn fn)
+    {
+        const size_t before = s_nAllocations;
+        fn();
+        const size_t made = s_nAllocations - before;
+        std::printf("%-50s %3zu allocation(s)%s\n", name, made, made == expected ? "" : "  <-- FAILED");
+        if (made != expected)
+            ++s_nFailures;
+    }
+
+    void check_containers()
+    {
+        expect_allocations("twain_span from a braced list", 0, []
+        {
+            // a span of a braced list is only valid as a function argument
+            auto count = [](twain_span<LONG> span) { return span.size(); };
+            if (count({ DTWAIN_PT_BW, DTWAIN_PT_GRAY }) != 2)
+                ++s_nFailures;
+        });
+
+        expect_allocations("twain_span of a single value", 0, []
+        {
+            const double value = 300.0;
+            auto span = twain_span<double>::of(value);
+            if (span.size() != 1 || span[0] != value)
+                ++s_nFailures;
+        });
+
+        expect_allocations("twain_small_vector within its inline capacity", 0, []
+        {
+            twain_small_vector<LONG, 4> values = { 1, 2, 3 };
+            values.push_back(4);
+            values.clear();
+            values.push_back(5);
+            if (!values.is_inline() || values.size() != 1)
+                ++s_nFailures;
+        });
+
+        expect_allocations("twain_small_vector past its inline capacity", 1, []
+        {
+            twain_small_vector<LONG, 2> values = { 1, 2 };
+            values.push_back(3);
+            if (values.is_inline() || values.size() != 3 || values[2] != 3)
+                ++s_nFailures;
+        });
+    }
+
+    void check_capability_round_trip(twain_source& source)
+    {
+        auto& ci = source.get_capability_interface();
+        auto pixel_type = ci.get_pixeltype<twain_small_vector<ICAP_PIXELTYPE_::value_type>>(capability_interface::get_current());
+        if (pixel_type.empty())
+        {
+            std::printf("ICAP_PIXELTYPE could not be retrieved: capability round trip skipped\n");
+            return;
+        }
+        const auto value = pixel_type.front();
+
+        // the first round trip fills the source's twain_array pool
+        ci.set_pixeltype(twain_span<ICAP_PIXELTYPE_::value_type>::of(value));
+        ci.get_pixeltype<twain_small_vector<ICAP_PIXELTYPE_::value_type>>(capability_interface::get_current());
+
+        expect_allocations("set_pixeltype with a braced list", 0, [&]
+        {
+            ci.set_pixeltype({ value });
+        });
+
+        expect_allocations("set_cap_value of a single value", 0, [&]
+        {
+            ci.set_cap_value<ICAP_PIXELTYPE_>(value);
+        });
+
+        expect_allocations("get/set round trip into a twain_small_vector", 0, [&]
+        {
+            auto current = ci.get_pixeltype<twain_small_vector<ICAP_PIXELTYPE_::value_type>>(capability_interface::get_current());
+            ci.set_pixeltype(twain_span<ICAP_PIXELTYPE_::value_type>(current));
+        });
+    }
+}
+
+int main()
+{
+    check_containers();
+
+    twain_session session;
+    session.start();
+    if (session)
+    {
+        twain_source source(session.select_source(select_default()));
+        if (source.is_open())
+            check_capability_round_trip(source);
+        else
+            std::printf("No TWAIN source could be opened: capability round trip skipped\n");
+    }
+    else
+        std::printf("The TWAIN session could not be started: capability round trip skipped\n");
+
+    std::printf("%s\n", s_nFailures ? "FAILED" : "OK");
+    return s_nFailures ? 1 : 0;
+}
@@ -32,6 +32,8 @@ OF THIRD PARTY RIGHTS.
 #include <boost/uuid/uuid_io.hpp>         
 #include <boost/algorithm/string/predicate.hpp>
 #include <dynarithmic/twain/twain_source.hpp>
+#include <dynarithmic/twain/source/acquisition_profile.hpp>
+#include <dynarithmic/twain/capability_interface/capability_constraints.hpp>
 #include <string>
 #include <iostream>
 #include <utility>
@@ -43,6 +45,8 @@ OF THIRD PARTY RIGHTS.
 #include <unordered_map>
 #include <nlohmann\json.hpp>
 #include <algorithm>
+#include <cctype>
+#include <functional>
 #include "twainsave_verinfo.h"
 
 std::string generate_details();
@@ -78,6 +82,7 @@ constexpr auto to_underlying(E e) noexcept
 #define RETURN_UIONLY_SUPPORT_ERROR     14  
 #define RETURN_COMMANDFILE_NOT_FOUND    15
 #define RETURN_COMMANDFILE_OPEN_ERROR   16
+#define RETURN_VALIDATION_FAILED        17
 std::unique_ptr<dynarithmic::twain::twain_source> g_source;
 
 struct scanner_options
@@ -151,7 +156,9 @@ struct scanner_options
     std::unordered_map<std::string, TW_UINT16> m_OptionToCapMap;
     int twainsave_return_value;
     std::string m_strConfigFile;
+    std::string m_strProfile;
     bool m_bUseVerbose;
+    bool m_bValidateOnly;
 
     scanner_options() : twainsave_return_value(RETURN_OK),
                             m_nOverwriteCount(1),
@@ -499,6 +506,7 @@ parse_return_type parse_options(int argc, char *argv[])
             ("pdfquality", po::value< int >(&pdf_commands.m_quality)->default_value(60), "set the JPEG quality factor for PDF files")
             ("pdforient", po::value< std::string >(&pdf_commands.m_strOrient)->default_value("portrait"), "Sets orientation to portrait or landscape")
             ("pdfscale", po::value< std::string >(&pdf_commands.m_strScale)->default_value("noscale"), "PDF page scaling")
+            ("profile", po::value< std::string >(&s_options.m_strProfile), "Acquisition profile file.  Created on first use, applied without validation on later runs, and recreated when the device or options change")
             ("resolution", po::value< double >(&s_options.m_dResolution), "Image resolution in dots per unit (see --unit)")
             ("rotation", po::value< double >(&s_options.m_dRotation), "Rotate page by the specified number of degrees (device must support rotation)")
             ("saveoncancel", po::bool_switch(&s_options.m_bSaveOnCancel)->default_value(false), "Save image file even if acquisition canceled by user")
@@ -516,6 +524,7 @@ parse_return_type parse_options(int argc, char *argv[])
             ("unitofmeasure", po::value< std::string >(&s_options.m_strUnitOfMeasure)->default_value("inch"), "Unit of measure")
             ("usedsm2", po::bool_switch(&s_options.m_bShowUIOnly)->default_value(false), "Use TWAINDSM.DLL if found as the data source manager.")
             ("useinc", po::bool_switch(&s_options.m_bUseFileInc)->default_value(false), "Use file name increment")
+            ("validate-only", po::bool_switch(&s_options.m_bValidateOnly)->default_value(false), "Check the options against the device's supported values and exit without acquiring")
             ("verbose", po::bool_switch(&s_options.m_bUseVerbose)->default_value(false), "Turn on verbose mode")
             ("version", "Display program version")
             ("@", po::value< std::string >(&s_options.m_strConfigFile), "Configuration file");
@@ -537,42 +546,114 @@ twain_source select_the_source(twain_session& tsession, SelectType s)
     return tsession.select_source(s);
 }
 
-template <typename T>
-void test_characteristic(twain_source& theSource, // TWAIN source
-                         const T& value, // value to test
-                         const po::variables_map& varmap, 
-                         const std::string& entry, 
-                         int capvalue = 0)
+// Returns the name that identifies the device and its driver version in the constraints cache
+std::string get_constraints_key(twain_source& theSource)
 {
-    auto iter = varmap.find(entry);
-    if (iter != varmap.end())
+    const auto& info = theSource.get_source_info();
+    return info.get_manufacturer() + "|" + info.get_product_family() + "|" + info.get_product_name() + "|" +
+           info.get_version_info();
+}
+
+// Returns the file used to cache the capability constraints of the device
+std::string get_constraints_filename(twain_source& theSource)
+{
+    std::string name = theSource.get_source_info().get_product_name();
+    std::replace_if(name.begin(), name.end(), [](char ch) { return !std::isalnum(static_cast<unsigned char>(ch)); }, '_');
+    const auto key_hash = std::hash<std::string>()(get_constraints_key(theSource));
+    return (boost::filesystem::temp_directory_path() / ("twainsave-" + name + "-" + std::to_string(key_hash) + ".constraints")).string();
+}
+
+// Validates the capability settings made by set_caps against the device's supported values and ranges in one pass.
+// The constraints are read from the cache file if it was made for the same device and driver version, so that the
+// device is only queried the first time.  If the cached constraints reject a setting, they are rebuilt from the
+// device before the setting is reported as unsupported.
+bool validate_options(twain_source& theSource, const po::variables_map& varmap)
+{
+    auto& ci = theSource.get_capability_interface();
+    const auto settings = theSource.get_capability_settings();
+
+    std::vector<int> caps;
+    for (auto& s : settings)
     {
-        if (!iter->second.defaulted())
-        {
-            if (capvalue && !varmap["verbose"].defaulted())
-            {
-                std::cout << "Checking if device supports " << entry << " ...\n";
-                // test if the source supports what we're supposed to be setting later
-                bool issupported = theSource.get_capability_interface().is_cap_supported(capvalue);
-                std::cout << (issupported?"Success!  ":"Sorry :( ") << "The TWAIN device \"" << theSource.get_source_info().get_product_name() << "\" does" << (issupported ? " " : " not ")
-                    << "support the \"--" << entry << "\" capability\n";
-                if (issupported)
-                {
-                    // now test if the device can actually use the value set
-                    std::vector<T> testArray;
-                    std::cout << "Testing if " << value << " can be used...\n";
-                    testArray = theSource.get_capability_interface().get_cap_values<decltype(testArray)>(capvalue, capability_interface::get());
-                    if ( !testArray.empty() )
-                    {
-                        bool valuefound = std::find(testArray.begin(), testArray.end(), value) != testArray.end();
-                        std::cout << (valuefound ? "Success!  " : "Sorry :( ") << "The TWAIN device \"" << theSource.get_source_info().get_product_name() << "\" does" << (valuefound ? " " : " not ")
-                                << " support the value " << value << " that you are using. capability\n";
-                    }
-                }
-            }
-            std::cout << "\n";
-        }
+        if (ci.is_cap_supported(s.cap_value))
+            caps.push_back(s.cap_value);
+    }
+
+    const std::string product_name = theSource.get_source_info().get_product_name();
+    const std::string key = get_constraints_key(theSource);
+    const std::string filename = get_constraints_filename(theSource);
+    capability_constraint_set constraints;
+    bool cached = constraints.load(filename) && constraints.get_key() == key &&
+                  std::all_of(caps.begin(), caps.end(), [&](int cap) { return constraints.is_supported(cap); });
+    auto report = cached ? constraints.validate(settings) : validation_report();
+    if (cached && (report.count(validation_status::capability_not_supported) > 0 ||
+                   report.count(validation_status::value_not_supported) > 0))
+        cached = false;
+    if (!cached)
+    {
+        constraints = capability_constraint_set::build(ci, product_name, caps);
+        constraints.set_key(key);
+        constraints.save(filename);
+        report = constraints.validate(settings);
     }
+
+    // report on the options that were given on the command line
+    bool options_valid = true;
+    std::cout << "Validating options for TWAIN device \"" << product_name << "\""
+              << (cached ? " (using cached constraints)" : "") << " ...\n";
+    for (auto& option : s_options.m_OptionToCapMap)
+    {
+        auto iter = varmap.find(option.first);
+        if (!option.second || iter == varmap.end() || iter->second.defaulted())
+            continue;
+        auto pResult = report.find(option.second);
+        const auto status = pResult ? pResult->status : validation_status::not_checked;
+        if (status == validation_status::capability_not_supported || status == validation_status::value_not_supported)
+            options_valid = false;
+        std::cout << "  --" << option.first << ": " << to_string(status) << "\n";
+    }
+    if (s_options.m_bUseVerbose)
+        std::cout << "\nAll capability settings:\n" << report;
+    std::cout << (options_valid ? "Success!  All options can be used\n" : "Sorry :( Some options are not supported by the device\n");
+    return options_valid;
+}
+
+// Reports the capabilities whose profile settings the device did not accept
+void report_failed_profile_settings(twain_source& theSource, const acquisition_profile& profile)
+{
+    for (auto cap : profile.get_failed_caps())
+        std::cout << "Sorry :( The TWAIN device \"" << theSource.get_source_info().get_product_name() << "\" did not accept the profile setting for "
+                  << capability_interface::get_cap_name_s(cap) << "\n";
+}
+
+// Applies the acquisition profile stored in filename.  A current profile is applied without validating the
+// options against the device.  If the profile does not exist, or was created for a different device or
+// different options, the options are validated and a new profile is compiled from them and saved.
+void apply_profile(twain_source& theSource, const po::variables_map& varmap, const std::string& filename)
+{
+    acquisition_profile profile;
+    if (profile.load(filename) && profile.apply(theSource))
+    {
+        if (s_options.m_bUseVerbose)
+            std::cout << "Using acquisition profile \"" << filename << "\" (" << profile.get_steps().size() << " settings)\n";
+        report_failed_profile_settings(theSource, profile);
+        return;
+    }
+
+    if (s_options.m_bUseVerbose)
+        validate_options(theSource, varmap);
+    profile = acquisition_profile::compile(theSource);
+    if (s_options.m_bUseVerbose)
+    {
+        std::cout << "Created acquisition profile \"" << filename << "\" (" << profile.get_steps().size() << " settings)\n";
+        for (auto cap : profile.get_rejected_caps())
+            std::cout << "Sorry :( The TWAIN device \"" << theSource.get_source_info().get_product_name() << "\" does not support the value set for "
+                      << capability_interface::get_cap_name_s(cap) << "\n";
+    }
+    if (!profile.save(filename) && s_options.m_bUseVerbose)
+        std::cout << "Could not save acquisition profile \"" << filename << "\"\n";
+    profile.apply(theSource);
+    report_failed_profile_settings(theSource, profile);
 }
 
 std::string resolve_extension(std::string filetype)
@@ -679,29 +760,6 @@ bool set_caps(twain_source& mysource, const po::variables_map& varmap)
         ac.get_jobcontrol_options().
             set_option(s_options.m_JobControlMap[s_options.m_nJobControl]);
 
-        // test the characteristics that have been set
-        test_characteristic(mysource, s_options.m_bAutobrightMode, varmap, "autobright", ICAP_AUTOBRIGHT);
-        test_characteristic(mysource, s_options.m_bDeskew, varmap, "deskew", ICAP_AUTOMATICDESKEW);
-        test_characteristic(mysource, s_options.m_bAutoRotateMode, varmap, "autorotate", ICAP_AUTOMATICROTATE);
-        test_characteristic(mysource, s_options.m_brightness, varmap, "brightness", ICAP_BRIGHTNESS);
-        test_characteristic(mysource, s_options.m_bUseTransparencyUnit?1:0, varmap, "transparency", ICAP_LIGHTPATH);
-        test_characteristic(mysource, s_options.m_dContrast, varmap, "contrast", ICAP_CONTRAST);
-        test_characteristic(mysource, s_options.m_dHighlight, varmap, "highlight", ICAP_HIGHLIGHT);
-        test_characteristic(mysource, s_options.m_dThreshold, varmap, "threshold", ICAP_THRESHOLD);
-        test_characteristic(mysource, s_options.m_dGamma, varmap, "gamma", ICAP_GAMMA);
-        test_characteristic(mysource, s_options.m_strHalftone, varmap, "halftone", ICAP_HALFTONES);
-        test_characteristic(mysource, s_options.m_dResolution, varmap, "resolution", ICAP_XRESOLUTION);
-        test_characteristic(mysource, s_options.m_dRotation, varmap, "rotation", ICAP_ROTATION);
-        test_characteristic(mysource, s_options.m_dShadow, varmap, "shadow", ICAP_SHADOW);
-        test_characteristic(mysource, s_options.m_bOverscanMode, varmap, "overscan", ICAP_OVERSCAN);
-        test_characteristic(mysource, s_options.m_bShowIndicator, varmap, "showindicator", CAP_INDICATORS);
-        test_characteristic(mysource, static_cast<long>(s_options.m_ColorTypeMap[s_options.m_color]), varmap, "color", ICAP_PIXELTYPE);
-        test_characteristic(mysource, static_cast<long>(s_options.m_MeasureUnitMap[s_options.m_strUnitOfMeasure]), varmap, "unitofmeasure", ICAP_UNITS);
-        test_characteristic(mysource, static_cast<long>(s_options.m_PageSizeMap[s_options.m_strPaperSize]), varmap, "papersize", ICAP_SUPPORTEDSIZES);
-        test_characteristic(mysource, static_cast<long>(s_options.m_OrientationTypeMap[s_options.m_Orientation]), varmap, "orientation", ICAP_ORIENTATION);
-        test_characteristic(mysource, s_options.m_strImprinter, varmap, "imprinterstring", CAP_PRINTER);
-        test_characteristic(mysource, static_cast<long>(s_options.m_JobControlMap[s_options.m_nJobControl]), varmap, "jobcontrol", CAP_JOBCONTROL);
-
         s_options.m_nOverwriteWidth = NumDigits(s_options.m_nOverwriteMax);
 
         auto& file_rules = ac.get_file_transfer_options().get_filename_increment_rules();
@@ -1009,6 +1067,15 @@ int start_acquisitions(const po::variables_map& varmap)
         return RETURN_TWAIN_INIT_ERROR;
     }
 
+    // check the options against the device and stop, without acquiring or querying the device further
+    if (s_options.m_bValidateOnly)
+    {
+        bool valid = set_caps(*g_source, varmap) && validate_options(*g_source, varmap);
+        s_options.set_return_code(valid ? RETURN_OK : RETURN_VALIDATION_FAILED);
+        g_source.reset();
+        return s_options.get_return_code();
+    }
+
     if (g_source->is_open())
     {
         // check for pixel types
@@ -1032,6 +1099,11 @@ int start_acquisitions(const po::variables_map& varmap)
 
         if (set_caps(*g_source, varmap))
         {
+            if (!s_options.m_strProfile.empty())
+                apply_profile(*g_source, varmap, s_options.m_strProfile);
+            else
+            if (s_options.m_bUseVerbose)
+                validate_options(*g_source, varmap);
             ts.register_listener(*g_source, STFCallback(&s_options)); 
             auto acq_return = g_source->acquire();
             if (acq_return.first == dynarithmic::twain::twain_source::acquire_timeout)